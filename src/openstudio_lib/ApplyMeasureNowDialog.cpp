@@ -40,6 +40,7 @@
 #include "../shared_gui_components/WorkflowController.hpp"
 
 #include "MainRightColumnController.hpp"
+#include "ModelDiff.hpp"
 #include "OSAppBase.hpp"
 #include "OSDocument.hpp"
 #include "OSItem.hpp"
@@ -48,6 +49,8 @@
 #include <openstudio/model/Model.hpp>
 #include <openstudio/model/Model_Impl.hpp>
 
+#include <openstudio/osversion/VersionTranslator.hpp>
+
 #include "../openstudio_app/OpenStudioApp.hpp"
 #include "../utilities/OpenStudioApplicationPathHelpers.hpp"
 
@@ -59,6 +62,7 @@
 #include <openstudio/utilities/time/DateTime.hpp>
 
 #include <QBoxLayout>
+#include <QCheckBox>
 #include <QCloseEvent>
 #include <QLabel>
 #include <QMessageBox>
@@ -90,6 +94,7 @@ ApplyMeasureNowDialog::ApplyMeasureNowDialog(QWidget* parent)
   m_jobItemView(nullptr),
   m_timer(nullptr),
   m_showAdvancedOutput(nullptr),
+  m_applyInPlaceCheckBox(nullptr),
   m_advancedOutput(QString()),
   m_workingDir(openstudio::path()),
   m_workingFilesDir(openstudio::path()),
@@ -252,9 +257,14 @@ void ApplyMeasureNowDialog::createWidgets()
 
   //layout->addStretch();
 
+  m_applyInPlaceCheckBox = new QCheckBox("Apply changes to the current model without reloading");
+  m_applyInPlaceCheckBox->setToolTip("Only objects added, removed or changed by the measure are updated, open tabs are kept");
+  m_applyInPlaceCheckBox->setChecked(true);
+
   auto hLayout = new QHBoxLayout();
   hLayout->addWidget(m_showAdvancedOutput);
   hLayout->addStretch();
+  hLayout->addWidget(m_applyInPlaceCheckBox);
   layout->addLayout(hLayout);
 
   widget = new QWidget();
@@ -805,8 +815,12 @@ void ApplyMeasureNowDialog::on_okButton(bool checked)
     // N/A
     OS_ASSERT(false);
   } else if(m_mainPaneStackedWidget->currentIndex() == m_outputPageIdx) {
-    // reload the model
-    requestReload();
+    if (m_applyInPlaceCheckBox->isChecked()){
+      requestApplyInPlace();
+    } else {
+      // reload the model
+      requestReload();
+    }
   }
 }
 
@@ -827,6 +841,61 @@ void ApplyMeasureNowDialog::requestReload()
   close();
 }
 
+void ApplyMeasureNowDialog::requestApplyInPlace()
+{
+  if (!applyInPlace()){
+    LOG(Warn, "Could not apply measure output in place, reloading the model");
+    requestReload();
+    return;
+  }
+
+  // copy any files created in m_workingFilesDir
+  std::vector<path> filePaths = m_modelWorkflowJSON.absoluteFilePaths();
+  if (!filePaths.empty()) {
+    copyDirectory(m_workingFilesDir, filePaths[0]);
+  }
+
+  // close the dialog
+  close();
+}
+
+bool ApplyMeasureNowDialog::applyInPlace()
+{
+  OS_ASSERT(m_reloadPath);
+
+  openstudio::OSAppBase * app = OSAppBase::instance();
+  boost::optional<model::Model> currentModel = app->currentModel();
+  if (!currentModel){
+    return false;
+  }
+
+  osversion::VersionTranslator versionTranslator;
+  boost::optional<model::Model> newModel = versionTranslator.loadModel(*m_reloadPath);
+  if (!newModel){
+    return false;
+  }
+
+  ModelDiff modelDiff(*currentModel, *newModel);
+  LOG(Debug, "Measure added " << modelDiff.addedObjects().size() << ", removed " << modelDiff.removedObjects().size()
+             << " and changed " << modelDiff.changedObjects().size() << " objects");
+
+  if (modelDiff.empty()){
+    return true;
+  }
+
+  // a partially applied diff leaves the live model in an unknown state, the reload fallback then restores it from disk
+  app->currentDocument()->disable();
+  bool result = modelDiff.apply();
+  app->currentDocument()->enable();
+
+  // on failure the model is reloaded from disk instead
+  if (result){
+    app->currentDocument()->markAsModified();
+  }
+
+  return result;
+}
+
 void ApplyMeasureNowDialog::closeEvent(QCloseEvent *e)
 {
   //DLM: don't do this here in case we are going to load the model
@@ -38,6 +38,7 @@
 
 #include <openstudio/utilities/bcl/BCLMeasure.hpp>
 
+class QCheckBox;
 class QPushButton;
 class QStackedWidget;
 class QTextEdit;
@@ -96,6 +97,8 @@ private slots:
 
   void requestReload();
 
+  void requestApplyInPlace();
+
   void showAdvancedOutput();
 
   void displayResults();
@@ -116,6 +119,9 @@ private:
 
   void searchForExistingResults(const openstudio::path &t_runDir);
 
+  // applies the measure output to the current model without reloading the document, returns false on failure
+  bool applyInPlace();
+
   void removeWorkingDir();
 
   void createWorkingDir();
@@ -154,6 +160,8 @@ private:
 
   QPushButton * m_showAdvancedOutput;
 
+  QCheckBox * m_applyInPlaceCheckBox;
+
   QString m_advancedOutput;
 
   openstudio::path m_workingDir;
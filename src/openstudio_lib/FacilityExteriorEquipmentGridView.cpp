@@ -30,6 +30,7 @@
 #include "FacilityExteriorEquipmentGridView.hpp"
 
 #include "OSItemSelectorButtons.hpp"
+#include "ScheduleEvaluation.hpp"
 
 #include "../shared_gui_components/OSGridView.hpp"
 
@@ -43,6 +44,8 @@
 #include <openstudio/model/ModelObject_Impl.hpp>
 #include <openstudio/model/Schedule.hpp>
 #include <openstudio/model/Schedule_Impl.hpp>
+#include <openstudio/model/ScheduleRuleset.hpp>
+#include <openstudio/model/ScheduleRuleset_Impl.hpp>
 
 #include <openstudio/utilities/core/Assert.hpp>
 #include <openstudio/utilities/idd/IddEnums.hxx>
@@ -63,6 +66,7 @@
 // EXTERIOR LIGHTS
 #define EXTERIORLIGHTSDEFINITION "Exterior Lights Definition"
 #define SCHEDULE "Schedule"
+#define ANNUALFULLLOADHOURS "Annual Full-Load Hours"
 #define CONTROLOPTION "Control Option"
 #define MULTIPLIER "Multiplier"
 #define ENDUSESUBCATEGORY "End Use Subcategory"
@@ -124,8 +128,11 @@ namespace openstudio {
     IddObjectType iddObjectType,
     model::Model model,
     std::vector<model::ModelObject> modelObjects) :
-    OSGridController(isIP, headerText, iddObjectType, model, modelObjects)
+    OSGridController(isIP, headerText, iddObjectType, model, modelObjects),
+    m_scheduleEvaluator(new ScheduleEvaluator(model, this))
   {
+    connect(m_scheduleEvaluator, &ScheduleEvaluator::invalidated, this, &FacilityExteriorEquipmentGridController::displayValuesChanged);
+
     setCategoriesAndFields();
   }
 
@@ -135,6 +142,7 @@ namespace openstudio {
       std::vector<QString> fields;
       fields.push_back(EXTERIORLIGHTSDEFINITION);
       fields.push_back(SCHEDULE);
+      fields.push_back(ANNUALFULLLOADHOURS);
       fields.push_back(CONTROLOPTION);
       fields.push_back(MULTIPLIER);
       fields.push_back(ENDUSESUBCATEGORY);
@@ -204,6 +212,24 @@ namespace openstudio {
           boost::optional<std::function<void(model::ExteriorLights*)>>(CastNullAdapter<model::ExteriorLights>(&model::ExteriorLights::resetSchedule))
         );
       }
+      else if (field == ANNUALFULLLOADHOURS) {
+        ScheduleEvaluator * scheduleEvaluator = m_scheduleEvaluator;
+
+        std::function<boost::optional<double>(model::ExteriorLights*)> get(
+          [scheduleEvaluator](model::ExteriorLights* el) {
+          boost::optional<double> result;
+          if (boost::optional<model::ScheduleRuleset> ruleset = el->schedule().optionalCast<model::ScheduleRuleset>()) {
+            result = scheduleEvaluator->statistics(ruleset.get()).fullLoadHours;
+          }
+          return result;
+        }
+        );
+
+        // Follows from the schedule, there is nothing to set or apply to the selected rows
+        addValueDisplayColumn(Heading(QString(ANNUALFULLLOADHOURS), true, false),
+          get
+          );
+      }
       else if (field == CONTROLOPTION){
         addComboBoxColumn<std::string, model::ExteriorLights>(
           Heading(QString(CONTROLOPTION)),
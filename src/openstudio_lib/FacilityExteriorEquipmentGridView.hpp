@@ -41,6 +41,8 @@ namespace openstudio{
 
   class FacilityExteriorEquipmentGridController;
 
+  class ScheduleEvaluator;
+
   class FacilityExteriorEquipmentGridView : public GridViewSubTab
   {
     Q_OBJECT
@@ -102,6 +104,11 @@ namespace openstudio{
 
     virtual void onComboBoxIndexChanged(int index);
 
+  private:
+
+    // Annual figures of the schedules, shared by all the rows
+    ScheduleEvaluator * m_scheduleEvaluator;
+
   };
 
 } // openstudio
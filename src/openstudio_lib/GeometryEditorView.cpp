@@ -68,6 +68,8 @@
 #include <openstudio/utilities/core/Checksum.hpp>
 #include <openstudio/utilities/bcl/RemoteBCL.hpp>
 #include <openstudio/utilities/geometry/FloorplanJS.hpp>
+#include <openstudio/utilities/geometry/Geometry.hpp>
+#include <openstudio/utilities/geometry/Transformation.hpp>
 #include <openstudio/utilities/geometry/ThreeJS.hpp>
 
 // Needed for getEnergyPlusExecutable for eg
@@ -92,8 +94,18 @@
 #include <QProcess>
 #include <QSettings>
 #include <QProcessEnvironment>
+#include <QPointer>
+#include <QTextStream>
+#include <QWebChannel>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QtConcurrent>
 
-const int CHECKFORUPDATEMSEC = 5000;
+#include <limits>
+
+// delay after the last change in the FloorspaceJS editor before its content is exported
+const int EXPORTAFTERCHANGEMSEC = 250;
 
 namespace openstudio {
 
@@ -160,9 +172,6 @@ BaseEditor::BaseEditor(bool isIP, const openstudio::model::Model& model, QWebEng
     m_model(model),
     m_view(view)
 {
-  m_checkForUpdateTimer = new QTimer(this);
-  connect(m_checkForUpdateTimer, SIGNAL(timeout()), this, SLOT(checkForUpdate()));
-
   openstudio::OSAppBase * app = OSAppBase::instance();
   OS_ASSERT(app);
   m_document = app->currentDocument();
@@ -182,10 +191,6 @@ bool BaseEditor::javascriptRunning() const
   return m_javascriptRunning;
 }
 
-bool BaseEditor::blockUpdateTimerSignals(bool block){
-  return m_checkForUpdateTimer->blockSignals(block);
-}
-
 model::Model BaseEditor::exportModel() const
 {
   return m_exportModel;
@@ -196,16 +201,47 @@ std::map<UUID, UUID> BaseEditor::exportModelHandleMapping() const
   return m_exportModelHandleMapping;
 }
 
+boost::optional<std::set<UUID>> BaseEditor::changedSpaces() const
+{
+  return boost::none;
+}
+
 void BaseEditor::onChanged()
 {
   emit changed();
   //m_document->markAsModified();
 }
 
+FloorspaceChannel::FloorspaceChannel(QObject *t_parent)
+  : QObject(t_parent)
+{
+}
+
+void FloorspaceChannel::notifyChanged(unsigned versionNumber)
+{
+  emit changed(versionNumber);
+}
+
 FloorspaceEditor::FloorspaceEditor(const openstudio::path& floorplanPath, bool isIP, const openstudio::model::Model& model, QWebEngineView * view, QWidget *t_parent)
   : BaseEditor(isIP, model, view, t_parent),
-  m_floorplanPath(floorplanPath)
+  m_floorplanPath(floorplanPath),
+  m_webChannel(new QWebChannel(this)),
+  m_channel(new FloorspaceChannel(this)),
+  m_exportTimer(new QTimer(this)),
+  m_exportNumber(0),
+  m_translatedExportNumber(0),
+  m_translationPending(false),
+  m_exportIsMergeBase(false)
 {
+  m_webChannel->registerObject(QStringLiteral("floorspaceChannel"), m_channel);
+  m_view->page()->setWebChannel(m_webChannel);
+  connect(m_channel, &FloorspaceChannel::changed, this, &FloorspaceEditor::onEditorChanged);
+
+  m_exportTimer->setSingleShot(true);
+  m_exportTimer->setInterval(EXPORTAFTERCHANGEMSEC);
+  connect(m_exportTimer, &QTimer::timeout, this, &FloorspaceEditor::onExportTimeout);
+  connect(&m_translationWatcher, &QFutureWatcher<FloorplanTranslation>::finished, this, &FloorspaceEditor::onTranslationFinished);
+
   m_document->disable();
 
   if (exists(m_floorplanPath)){
@@ -254,16 +290,37 @@ FloorspaceEditor::FloorspaceEditor(const openstudio::path& floorplanPath, bool i
 }
 
 FloorspaceEditor::~FloorspaceEditor()
-{}
+{
+  m_translationWatcher.waitForFinished();
+
+  if (m_view->page()->webChannel() == m_webChannel){
+    m_view->page()->setWebChannel(nullptr);
+  }
+}
 
 void FloorspaceEditor::loadEditor()
 {
-  // set config
+  // scripts run in the order they are queued on the page, only the last one needs to report back
+  QPointer<FloorspaceEditor> self(this);
+
+  // connect the web channel, the onChange callback below pushes change notifications through it
   {
-    OS_ASSERT(!m_javascriptRunning);
+    QFile channelFile(":/qtwebchannel/qwebchannel.js");
+    bool test = channelFile.open(QFile::ReadOnly | QFile::Text);
+    OS_ASSERT(test);
+    QTextStream channelStream(&channelFile);
+    QString javascript = channelStream.readAll();
+    channelFile.close();
 
-    m_javascriptRunning = true;
+    javascript += "\nnew QWebChannel(qt.webChannelTransport, function(channel) {\n\
+  window.floorspaceChannel = channel.objects.floorspaceChannel;\n\
+});\n";
 
+    m_view->page()->runJavaScript(javascript);
+  }
+
+  // set config
+  {
     Json::Value config(Json::objectValue);
     config["showImportExport"] = false;
 
@@ -316,32 +373,106 @@ void FloorspaceEditor::loadEditor()
 
     const std::string json = Json::writeString(wbuilder, config);
 
-    QString javascript = QString("window.api.setConfig(") + QString::fromStdString(json) + QString(");");
-    m_view->page()->runJavaScript(javascript, [this](const QVariant &v) {m_javascriptRunning = false; });
-    while (m_javascriptRunning){
-      OSAppBase::instance()->processEvents(QEventLoop::ExcludeUserInputEvents, 200);
-    }
+    QString javascript = QString("(function() {\n\
+  var config = ") + QString::fromStdString(json) + QString(";\n\
+  config.onChange = function() {\n\
+    if (window.applyingFloorplanPatch) {\n\
+      return;\n\
+    }\n\
+    window.versionNumber += 1;\n\
+    if (window.floorspaceChannel) {\n\
+      window.floorspaceChannel.notifyChanged(window.versionNumber);\n\
+    }\n\
+  };\n\
+  window.api.setConfig(config);\n\
+})();");
+    m_view->page()->runJavaScript(javascript);
   }
 
   // start the app
   {
-    OS_ASSERT(!m_javascriptRunning);
-
-    m_javascriptRunning = true;
-
     QString javascript = QString("window.api.init();");
-    m_view->page()->runJavaScript(javascript, [this](const QVariant &v) {m_javascriptRunning = false; });
-    while (m_javascriptRunning){
-      OSAppBase::instance()->processEvents(QEventLoop::ExcludeUserInputEvents, 200);
-    }
+    m_view->page()->runJavaScript(javascript);
   }
 
-  // customize css
+  // applies a JSON patch of properties of stories, spaces and library objects to the store, anything else needs openFloorplan.
+  // Floorspace has no api for this, the patch commits the Vuex mutations models/updateStoryWithData,
+  // models/updateSpaceWithData and models/updateObjectWithData on window.application.$store, each taking the store object
+  // and the properties to set, and looks objects up in $store.state.models.stories and $store.state.models.library.
+  // These are internals of the bundled Floorspace build. The export is not the same text as FloorplanJS::toJSON, so
+  // the result is checked by reading each patched path back from a new export, returns false if any of them differs.
   {
-    OS_ASSERT(!m_javascriptRunning);
-
-    m_javascriptRunning = true;
+    QString javascript = "(function() {\n\
+  var findById = function(objects, id) {\n\
+    return (objects || []).find(function(object) { return object.id === id; });\n\
+  };\n\
+  var exportFloorplan = function() {\n\
+    var floorplan = window.api.exportFloorplan();\n\
+    return (typeof floorplan === 'string') ? JSON.parse(floorplan) : floorplan;\n\
+  };\n\
+  var valueAt = function(floorplan, path) {\n\
+    return path.reduce(function(object, token) {\n\
+      return (object !== null && typeof object === 'object') ? object[token] : undefined;\n\
+    }, floorplan);\n\
+  };\n\
+  var fixedKeys = ['id', 'face_id', 'geometry_id'];\n\
+  window.applyFloorplanPatch = function(patch) {\n\
+    var floorplan = exportFloorplan();\n\
+    var models = window.application.$store.state.models;\n\
+    var updates = [];\n\
+    var paths = [];\n\
+    for (var i = 0; i < patch.length; ++i) {\n\
+      var op = patch[i];\n\
+      if ((op.op !== 'replace' && op.op !== 'add') || (op.value !== null && typeof op.value === 'object')) {\n\
+        return false;\n\
+      }\n\
+      var path = op.path.split('/').slice(1).map(function(token) {\n\
+        return token.replace(/~1/g, '/').replace(/~0/g, '~');\n\
+      });\n\
+      paths.push(path);\n\
+      var key = path[path.length - 1];\n\
+      var story = (path[0] === 'stories') ? floorplan.stories[path[1]] : null;\n\
+      var storeStory = story ? findById(models.stories, story.id) : null;\n\
+      var update = null;\n\
+      if (storeStory && path.length === 3) {\n\
+        update = { mutation: 'models/updateStoryWithData', data: { story: storeStory } };\n\
+      } else if (storeStory && path.length === 5 && path[2] === 'spaces') {\n\
+        var space = story.spaces[path[3]];\n\
+        var storeSpace = space ? findById(storeStory.spaces, space.id) : null;\n\
+        if (storeSpace) {\n\
+          update = { mutation: 'models/updateSpaceWithData', data: { space: storeSpace } };\n\
+        }\n\
+      } else if (path.length === 3 && models.library[path[0]] && floorplan[path[0]]) {\n\
+        var object = floorplan[path[0]][path[1]];\n\
+        var storeObject = object ? findById(models.library[path[0]], object.id) : null;\n\
+        if (storeObject) {\n\
+          update = { mutation: 'models/updateObjectWithData', data: { object: storeObject } };\n\
+        }\n\
+      }\n\
+      if (!update || fixedKeys.indexOf(key) !== -1) {\n\
+        return false;\n\
+      }\n\
+      update.data[key] = op.value;\n\
+      updates.push(update);\n\
+    }\n\
+    window.applyingFloorplanPatch = true;\n\
+    try {\n\
+      updates.forEach(function(update) { window.application.$store.commit(update.mutation, update.data); });\n\
+      // an unknown mutation is only logged, check that the export now holds the patched values\n\
+      var exported = exportFloorplan();\n\
+      return patch.every(function(op, i) { return valueAt(exported, paths[i]) === op.value; });\n\
+    } catch (e) {\n\
+      return false;\n\
+    } finally {\n\
+      window.applyingFloorplanPatch = false;\n\
+    }\n\
+  };\n\
+})();";
+    m_view->page()->runJavaScript(javascript);
+  }
 
+  // customize css
+  {
     QFile cssFile(":/library/geometry_editor.css");
     bool test = cssFile.open(QFile::ReadOnly | QFile::Text);
     OS_ASSERT(test);
@@ -357,113 +488,108 @@ style.type = 'text/css';\n\
 style.innerHTML = rules;\n\
 document.head.appendChild(style);\n";
 
-    m_view->page()->runJavaScript(javascript, [this](const QVariant &v) {m_javascriptRunning = false; });
-    while (m_javascriptRunning){
-      OSAppBase::instance()->processEvents(QEventLoop::ExcludeUserInputEvents, 200);
-    }
+    m_view->page()->runJavaScript(javascript);
   }
 
   // create library from current model
-  {
-    OS_ASSERT(!m_javascriptRunning);
+  QString javascript;
+  if (m_floorplan){
 
-    if (m_floorplan){
+    // import the current floorplan
+    std::string json = m_floorplan->toJSON(false);
 
-      // import the current floorplan
-      m_javascriptRunning = true;
+    javascript = QString("window.api.openFloorplan(JSON.stringify(") + QString::fromStdString(json) + QString("), { noReloadGrid: false });");
 
-      std::string json = m_floorplan->toJSON(false);
+  } else{
 
-      QString javascript = QString("window.api.openFloorplan(JSON.stringify(") + QString::fromStdString(json) + QString("), { noReloadGrid: false });");
-      m_view->page()->runJavaScript(javascript, [this](const QVariant &v) {m_javascriptRunning = false; });
-      while (m_javascriptRunning){
-        OSAppBase::instance()->processEvents(QEventLoop::ExcludeUserInputEvents, 200);
-      }
+    // import current model content as library
+    FloorplanJS floorplan;
+    floorplan.setUnits("si");
 
-    } else{
+    model::FloorplanJSForwardTranslator ft;
+    floorplan = ft.updateFloorplanJS(floorplan, m_model, false);
 
-      // import current model content as library
-      FloorplanJS floorplan;
-      floorplan.setUnits("si");
+    QString errorsAndWarnings;
+    for (const auto& error : ft.errors()){
+      errorsAndWarnings += QString::fromStdString(error.logMessage() + "\n");
+    }
+    for (const auto& warning : ft.warnings()){
+      errorsAndWarnings += QString::fromStdString(warning.logMessage() + "\n");
+    }
+    if (!errorsAndWarnings.isEmpty()){
+      QMessageBox::warning(qobject_cast<QWidget*>(parent()), QString("Updating Floorplan"), errorsAndWarnings);
+    }
 
-      model::FloorplanJSForwardTranslator ft;
-      floorplan = ft.updateFloorplanJS(floorplan, m_model, false);
+    std::string json = floorplan.toJSON(false);
 
-      QString errorsAndWarnings;
-      for (const auto& error : ft.errors()){
-        errorsAndWarnings += QString::fromStdString(error.logMessage() + "\n");
-      }
-      for (const auto& warning : ft.warnings()){
-        errorsAndWarnings += QString::fromStdString(warning.logMessage() + "\n");
-      }
-      if (!errorsAndWarnings.isEmpty()){
-        QMessageBox::warning(qobject_cast<QWidget*>(parent()), QString("Updating Floorplan"), errorsAndWarnings);
-      }
+    javascript = QString("window.api.importLibrary(JSON.stringify(") + QString::fromStdString(json) + QString("));");
+  }
 
-      m_javascriptRunning = true;
-
-      std::string json = floorplan.toJSON(false);
-      // TODO: @macumber: delete this now?
-      // DLM: temp
-      // Json::CharReaderBuilder rbuilder;
-      // std::istringstream ss(json);
-      // std::string errorString;
-      // Json::Value value;
-      // bool parsingSuccessful = Json::parseFromStream(rbuilder, ss, &value, &errorString);
-      // value.removeMember("stories");
-      // Json::StreamWriterBuilder wbuilder;
-      // // mimic the old FastWriter behavior:
-      // wbuilder["commentStyle"] = "None";
-      // wbuilder["indentation"] = "";
-      // const std::string json = Json::writeString(wbuilder, value);
-
-      QString javascript = QString("window.api.importLibrary(JSON.stringify(") + QString::fromStdString(json) + QString("));");
-      m_view->page()->runJavaScript(javascript, [this](const QVariant &v) {m_javascriptRunning = false; });
-      while (m_javascriptRunning){
-        OSAppBase::instance()->processEvents(QEventLoop::ExcludeUserInputEvents, 200);
-      }
+  m_view->page()->runJavaScript(javascript, [self](const QVariant &v) {
+    if (!self){
+      return;
     }
-  }
 
-  m_editorLoaded = true;
+    self->m_editorLoaded = true;
+
+    // changes are counted from here, importing resets window.versionNumber
+    self->m_versionNumber = 0;
 
-  // start checking for updates
-  m_versionNumber = 0;
-  m_checkForUpdateTimer->start(CHECKFORUPDATEMSEC);
+    // initial export so saving has the content of the editor. a saved floorplan may hold edits that were never merged,
+    // so there is no merge base yet and the first merge of the session goes through ModelMerger
+    self->doExport(std::function<void()>());
+  });
 }
 
-void FloorspaceEditor::doExport()
+void FloorspaceEditor::doExport(const std::function<void()>& onExported)
 {
-  bool t = true;
+  if (!m_editorLoaded){
+    return;
+  }
 
-  if (m_editorLoaded && !m_javascriptRunning){
-    m_javascriptRunning = true;
-    m_document->disable();
-    QString javascript = QString("JSON.stringify(window.api.exportFloorplan());");
-    m_view->page()->runJavaScript(javascript, [this](const QVariant &v) {
-      m_export = v;
-      m_javascriptRunning = false;
-    });
-    while (m_javascriptRunning){
-      OSAppBase::instance()->processEvents(QEventLoop::ExcludeUserInputEvents, 200);
+  // this export covers any pending change
+  m_exportTimer->stop();
+
+  QPointer<FloorspaceEditor> self(this);
+  QString javascript = QString("JSON.stringify(window.api.exportFloorplan());");
+  m_view->page()->runJavaScript(javascript, [self, onExported](const QVariant &v) {
+    if (!self){
+      return;
     }
-    m_document->enable();
 
-    // DLM: what if this fails?
-    std::string contents = m_export.value<QString>().toStdString();
-    m_floorplan = FloorplanJS::load(contents);
+    if (self->m_exportIsMergeBase){
+      self->m_exportIsMergeBase = false;
+      self->m_mergedExport = v.toString();
+    }
 
-    if (!m_floorplan){
-      // DLM: This is an error
-      t = false;
+    // unchanged content keeps the current translation
+    if (v != self->m_export){
+      self->m_export = v;
+      ++self->m_exportNumber;
+      self->startTranslation();
     }
 
-  } else{
-      // DLM: This is an error
-      t = false;
+    if (onExported){
+      onExported();
+    }
+  });
+}
+
+void FloorspaceEditor::onEditorChanged(unsigned versionNumber)
+{
+  if (!m_editorLoaded || (versionNumber == m_versionNumber)){
+    return;
   }
 
-  OS_ASSERT(t);
+  m_versionNumber = versionNumber;
+  onChanged();
+
+  m_exportTimer->start();
+}
+
+void FloorspaceEditor::onExportTimeout()
+{
+  doExport(std::function<void()>());
 }
 
 void FloorspaceEditor::saveExport()
@@ -488,45 +614,365 @@ void FloorspaceEditor::saveExport()
   }
 }
 
-void FloorspaceEditor::translateExport()
-{
-  model::ThreeJSReverseTranslator rt;
-  boost::optional<model::Model> model;
-  if (m_floorplan){
-    ThreeScene scene = m_floorplan->toThreeScene(true);
-    model = rt.modelFromThreeJS(scene);
+namespace {
+
+  QJsonObject withoutKeys(QJsonObject object, const QStringList& keys)
+  {
+    for (const auto& key : keys){
+      object.remove(key);
+    }
+    return object;
+  }
+
+  QString jsonId(const QJsonValue& value)
+  {
+    return value.toVariant().toString();
+  }
+
+  std::map<QString, QJsonObject> jsonById(const QJsonArray& array)
+  {
+    std::map<QString, QJsonObject> result;
+    for (const auto& value : array){
+      QJsonObject object = value.toObject();
+      result[jsonId(object.value("id"))] = object;
+    }
+    return result;
+  }
+
+  // what a space of a floorplan story turns into, the edges of its face and the windows and doors on them
+  struct SpaceFootprint
+  {
+    QJsonObject properties;
+    QJsonArray geometry;
+    std::set<QString> vertexIds;
+    double minX = std::numeric_limits<double>::max();
+    double minY = std::numeric_limits<double>::max();
+    double maxX = std::numeric_limits<double>::lowest();
+    double maxY = std::numeric_limits<double>::lowest();
+
+    bool overlaps(const SpaceFootprint& other) const
+    {
+      return (minX < other.maxX) && (other.minX < maxX) && (minY < other.maxY) && (other.minY < maxY);
+    }
+  };
+
+  std::map<QString, SpaceFootprint> spaceFootprints(const QJsonObject& story)
+  {
+    QJsonObject geometry = story.value("geometry").toObject();
+    std::map<QString, QJsonObject> vertices = jsonById(geometry.value("vertices").toArray());
+    std::map<QString, QJsonObject> edges = jsonById(geometry.value("edges").toArray());
+    std::map<QString, QJsonObject> faces = jsonById(geometry.value("faces").toArray());
+
+    std::multimap<QString, QJsonObject> openings;
+    for (const auto& key : {QString("windows"), QString("doors")}){
+      for (const auto& value : story.value(key).toArray()){
+        QJsonObject opening = value.toObject();
+        openings.insert(std::make_pair(jsonId(opening.value("edge_id")), opening));
+      }
+    }
+
+    std::map<QString, SpaceFootprint> result;
+    for (const auto& value : story.value("spaces").toArray()){
+      QJsonObject space = value.toObject();
+      SpaceFootprint& footprint = result[jsonId(space.value("id"))];
+      footprint.properties = withoutKeys(space, {"face_id"});
+
+      auto face = faces.find(jsonId(space.value("face_id")));
+      if (face == faces.end()){
+        continue;
+      }
+
+      QJsonArray edgeIds = face->second.value("edge_ids").toArray();
+      QJsonArray edgeOrder = face->second.value("edge_order").toArray();
+      for (int i = 0; i < edgeIds.size(); ++i){
+        QString edgeId = jsonId(edgeIds[i]);
+        QJsonArray edgeGeometry;
+        edgeGeometry.append(edgeOrder.at(i));
+
+        auto edge = edges.find(edgeId);
+        if (edge != edges.end()){
+          for (const auto& vertexId : edge->second.value("vertex_ids").toArray()){
+            auto vertex = vertices.find(jsonId(vertexId));
+            if (vertex != vertices.end()){
+              double x = vertex->second.value("x").toDouble();
+              double y = vertex->second.value("y").toDouble();
+              edgeGeometry.append(x);
+              edgeGeometry.append(y);
+              footprint.vertexIds.insert(vertex->first);
+              footprint.minX = std::min(footprint.minX, x);
+              footprint.minY = std::min(footprint.minY, y);
+              footprint.maxX = std::max(footprint.maxX, x);
+              footprint.maxY = std::max(footprint.maxY, y);
+            }
+          }
+        }
+
+        auto range = openings.equal_range(edgeId);
+        for (auto it = range.first; it != range.second; ++it){
+          edgeGeometry.append(it->second);
+        }
+
+        footprint.geometry.append(edgeGeometry);
+      }
+    }
+
+    return result;
+  }
+
+  // compares two exports story by story, returns the handles of the spaces whose geometry changed along with the spaces
+  // next to them, none if anything besides space geometry changed or a space has not been merged yet
+  boost::optional<std::set<UUID>> floorplanChangeSet(const QString& previous, const QString& current)
+  {
+    QJsonObject previousFloorplan = QJsonDocument::fromJson(previous.toUtf8()).object();
+    QJsonObject currentFloorplan = QJsonDocument::fromJson(current.toUtf8()).object();
+    if (previousFloorplan.isEmpty() || currentFloorplan.isEmpty()){
+      return boost::none;
+    }
+
+    // the application state and the grid or view settings do not make it into the model
+    if (withoutKeys(previousFloorplan, {"application", "project", "stories"}) != withoutKeys(currentFloorplan, {"application", "project", "stories"})){
+      return boost::none;
+    }
+    if (withoutKeys(previousFloorplan.value("project").toObject(), {"grid", "view"}) != withoutKeys(currentFloorplan.value("project").toObject(), {"grid", "view"})){
+      return boost::none;
+    }
+
+    QJsonArray previousStories = previousFloorplan.value("stories").toArray();
+    QJsonArray currentStories = currentFloorplan.value("stories").toArray();
+    if (previousStories.size() != currentStories.size()){
+      return boost::none;
+    }
+
+    std::vector<std::map<QString, SpaceFootprint>> previousSpaces;
+    std::vector<std::map<QString, SpaceFootprint>> currentSpaces;
+    std::vector<std::set<QString>> changedIds(currentStories.size());
+    for (int i = 0; i < currentStories.size(); ++i){
+      QJsonObject previousStory = previousStories[i].toObject();
+      QJsonObject currentStory = currentStories[i].toObject();
+
+      // story properties, heights and shading are left to ModelMerger
+      QStringList geometryKeys{"geometry", "spaces", "windows", "doors", "images"};
+      if (withoutKeys(previousStory, geometryKeys) != withoutKeys(currentStory, geometryKeys)){
+        return boost::none;
+      }
+
+      previousSpaces.push_back(spaceFootprints(previousStory));
+      currentSpaces.push_back(spaceFootprints(currentStory));
+      if (previousSpaces.back().size() != currentSpaces.back().size()){
+        return boost::none;
+      }
+
+      for (const auto& space : currentSpaces.back()){
+        auto previousSpace = previousSpaces.back().find(space.first);
+        if (previousSpace == previousSpaces.back().end()){
+          return boost::none;
+        }
+        if (space.second.properties != previousSpace->second.properties){
+          return boost::none;
+        }
+        if (space.second.properties.value("handle").toString().isEmpty()){
+          return boost::none;
+        }
+        if (space.second.geometry != previousSpace->second.geometry){
+          changedIds[i].insert(space.first);
+        }
+      }
+    }
+
+    // spaces sharing a vertex on the same story or overlapping on the stories above and below may have their surfaces
+    // split or matched differently, before or after the change
+    std::set<UUID> result;
+    for (int i = 0; i < currentStories.size(); ++i){
+      for (const auto& changedId : changedIds[i]){
+        for (int j = std::max(0, i - 1); j <= std::min(currentStories.size() - 1, i + 1); ++j){
+          for (const auto& space : currentSpaces[j]){
+            bool affected = false;
+            for (const auto& spaces : {&previousSpaces, &currentSpaces}){
+              const SpaceFootprint& changed = (*spaces)[i].at(changedId);
+              const SpaceFootprint& other = (*spaces)[j].at(space.first);
+              if (i == j){
+                for (const auto& vertexId : changed.vertexIds){
+                  affected = affected || (other.vertexIds.count(vertexId) > 0);
+                }
+              } else{
+                affected = affected || changed.overlaps(other);
+              }
+            }
+            if (affected || ((i == j) && (space.first == changedId))){
+              result.insert(toUUID(toString(space.second.properties.value("handle").toString())));
+            }
+          }
+        }
+      }
+    }
+
+    return result;
+  }
+
+  QString jsonPointerToken(QString key)
+  {
+    return key.replace("~", "~0").replace("/", "~1");
+  }
+
+  // appends the RFC 6902 operations turning previous into current to patch, arrays changing size are replaced whole
+  void jsonPatch(const QJsonValue& previous, const QJsonValue& current, const QString& path, QJsonArray& patch)
+  {
+    if (previous == current){
+      return;
+    }
+
+    if (previous.isObject() && current.isObject()){
+      QJsonObject previousObject = previous.toObject();
+      QJsonObject currentObject = current.toObject();
+      for (auto it = previousObject.begin(); it != previousObject.end(); ++it){
+        if (!currentObject.contains(it.key())){
+          patch.append(QJsonObject{{"op", "remove"}, {"path", path + "/" + jsonPointerToken(it.key())}});
+        }
+      }
+      for (auto it = currentObject.begin(); it != currentObject.end(); ++it){
+        QString childPath = path + "/" + jsonPointerToken(it.key());
+        if (previousObject.contains(it.key())){
+          jsonPatch(previousObject.value(it.key()), it.value(), childPath, patch);
+        } else{
+          patch.append(QJsonObject{{"op", "add"}, {"path", childPath}, {"value", it.value()}});
+        }
+      }
+      return;
+    }
+
+    if (previous.isArray() && current.isArray() && (previous.toArray().size() == current.toArray().size())){
+      QJsonArray previousArray = previous.toArray();
+      QJsonArray currentArray = current.toArray();
+      for (int i = 0; i < currentArray.size(); ++i){
+        jsonPatch(previousArray[i], currentArray[i], path + "/" + QString::number(i), patch);
+      }
+      return;
+    }
+
+    patch.append(QJsonObject{{"op", "replace"}, {"path", path}, {"value", current}});
+  }
+
+  // runs on a worker thread
+  FloorplanTranslation translateFloorplan(const QString& contents, const QString& mergedExport, unsigned exportNumber)
+  {
+    FloorplanTranslation result;
+    result.exportNumber = exportNumber;
+
+    // DLM: what if this fails?
+    result.floorplan = FloorplanJS::load(contents.toStdString());
+    if (!result.floorplan){
+      // DLM: this is an error, the editor produced a JSON we can't read
+      result.errorsAndWarnings = QString("Could not read the exported floorplan\n");
+      return result;
+    }
+
+    model::ThreeJSReverseTranslator rt;
+    ThreeScene scene = result.floorplan->toThreeScene(true);
+    result.model = rt.modelFromThreeJS(scene);
 
-    if (model){
+    if (result.model){
       // set north axis
-      model->getUniqueModelObject<model::Building>().setNorthAxis(m_floorplan->northAxis());
+      result.model->getUniqueModelObject<model::Building>().setNorthAxis(result.floorplan->northAxis());
 
       // TODO: synchronize latitude and longitude
+
+      result.handleMapping = rt.handleMapping();
+
+      if (!mergedExport.isEmpty()){
+        result.changedSpaces = floorplanChangeSet(mergedExport, contents);
+      }
     }
-  } else{
-    // DLM: this is an error, the editor produced a JSON we can't read
+
+    for (const auto& error : rt.errors()){
+      result.errorsAndWarnings += QString::fromStdString(error.logMessage() + "\n");
+    }
+    for (const auto& warning : rt.warnings()){
+      result.errorsAndWarnings += QString::fromStdString(warning.logMessage() + "\n");
+    }
+
+    return result;
   }
 
-  QString errorsAndWarnings;
-  for (const auto& error : rt.errors()){
-    errorsAndWarnings += QString::fromStdString(error.logMessage() + "\n");
+}
+
+void FloorspaceEditor::startTranslation()
+{
+  emit translationReady(false);
+
+  if (m_translationWatcher.isRunning()){
+    m_translationPending = true;
+    return;
   }
-  for (const auto& warning : rt.warnings()){
-    errorsAndWarnings += QString::fromStdString(warning.logMessage() + "\n");
+
+  m_translationWatcher.setFuture(QtConcurrent::run(translateFloorplan, m_export.toString(), m_mergedExport, m_exportNumber));
+}
+
+void FloorspaceEditor::onTranslationFinished()
+{
+  // a newer export came in while translating, the latest one wins
+  if (m_translationPending){
+    m_translationPending = false;
+    startTranslation();
+    return;
   }
-  if (!errorsAndWarnings.isEmpty()){
-    QMessageBox::warning(qobject_cast<QWidget*>(parent()), "Creating Model From Floorplan", errorsAndWarnings);
+
+  FloorplanTranslation translation = m_translationWatcher.result();
+  if (translation.exportNumber == m_exportNumber){
+    applyTranslation(translation);
+    emit translationReady(true);
   }
+}
 
-  if (model){
-    m_exportModel = *model;
-    m_exportModelHandleMapping = rt.handleMapping();
+void FloorspaceEditor::applyTranslation(const FloorplanTranslation& translation)
+{
+  if (translation.floorplan){
+    m_floorplan = translation.floorplan;
+  }
+
+  if (translation.model){
+    m_exportModel = *translation.model;
+    m_exportModelHandleMapping = translation.handleMapping;
+    m_changedSpaces = translation.changedSpaces;
   } else{
     // DLM: this is an error, either floorplan was empty or could not be translated
     m_exportModel = model::Model();
     m_exportModelHandleMapping.clear();
+    m_changedSpaces.reset();
+  }
+
+  m_translationErrorsAndWarnings = translation.errorsAndWarnings;
+  m_translatedExportNumber = translation.exportNumber;
+}
+
+void FloorspaceEditor::translateExport()
+{
+  // normally the background translation of the last export is already done
+  if (m_translatedExportNumber != m_exportNumber){
+    m_translationWatcher.waitForFinished();
+
+    FloorplanTranslation translation;
+    if (m_translationWatcher.future().resultCount() > 0){
+      translation = m_translationWatcher.result();
+    }
+    if (translation.exportNumber != m_exportNumber){
+      translation = translateFloorplan(m_export.toString(), m_mergedExport, m_exportNumber);
+    }
+    applyTranslation(translation);
+
+    m_translationPending = false;
+    emit translationReady(true);
+  }
+
+  if (!m_translationErrorsAndWarnings.isEmpty()){
+    QMessageBox::warning(qobject_cast<QWidget*>(parent()), "Creating Model From Floorplan", m_translationErrorsAndWarnings);
   }
 }
 
+boost::optional<std::set<UUID>> FloorspaceEditor::changedSpaces() const
+{
+  return m_changedSpaces;
+}
+
 void FloorspaceEditor::updateModel(const openstudio::model::Model& model)
 {
   if (m_floorplan){
@@ -548,60 +994,48 @@ void FloorspaceEditor::updateModel(const openstudio::model::Model& model)
       QMessageBox::warning(qobject_cast<QWidget*>(parent()), "Updating Floorplan", errorsAndWarnings);
     }
 
-    OS_ASSERT(!m_javascriptRunning);
-    m_javascriptRunning = true;
-
     // import updated floorplan back into editor
     OS_ASSERT(m_floorplan);
     std::string json = m_floorplan->toJSON(false);
 
-    QString javascript = QString("window.api.openFloorplan(JSON.stringify(") + QString::fromStdString(json) + QString("), { noReloadGrid: true });");
-    //QString javascript = QString("window.api.importLibrary(JSON.stringify(") + QString::fromStdString(json) + QString("));");
-    m_view->page()->runJavaScript(javascript, [this](const QVariant &v) {m_javascriptRunning = false; });
-    while (m_javascriptRunning){
-      OSAppBase::instance()->processEvents(QEventLoop::ExcludeUserInputEvents, 200);
-    }
-  }
-}
-
-void FloorspaceEditor::checkForUpdate()
-{
-  if (!m_javascriptRunning){
-    m_javascriptRunning = true;
-
-    // DLM: don't disable and enable the tabs, too distracting
-    //m_document->disable();
-
-    unsigned currentVersionNumber = m_versionNumber;
-
-    QString javascript = QString("window.versionNumber;");
-    m_view->page()->runJavaScript(javascript, [this](const QVariant &v) {m_versionNumber = v.toUInt();  m_javascriptRunning = false; });
+    // new handles, renames and assignments only touch a few values, patch those rather than reloading the floorplan
+    QJsonArray patch;
+    jsonPatch(QJsonDocument::fromJson(m_export.toString().toUtf8()).object(), QJsonDocument::fromJson(QByteArray::fromStdString(json)).object(), QString(), patch);
+
+    // the editor will hold the updated floorplan which now matches the model
+    m_exportTimer->stop();
+    m_export = QString::fromStdString(json);
+    m_mergedExport = m_export.toString();
+    ++m_exportNumber;
+    startTranslation();
+
+    QPointer<FloorspaceEditor> self(this);
+    QString javascript = QString("window.applyFloorplanPatch(") + QString::fromUtf8(QJsonDocument(patch).toJson(QJsonDocument::Compact)) + QString(");");
+    m_view->page()->runJavaScript(javascript, [self, json](const QVariant &v) {
+      if (!self){
+        return;
+      }
 
-    // DLM: the javascript engine appears to stop when a file dialog is launched by the editor (e.g. to import an image)
-    int processEventsTime = 200;
-    boost::posix_time::ptime start = boost::posix_time::microsec_clock::universal_time();
-    while (m_javascriptRunning){
-      // if the javascript is taking too long to evaluate, bail out here
-      // DLM: multiply elapsed time by two, we want to make sure we have half of the time between update checks to process other events
-      int elapsed = 2 * (boost::posix_time::microsec_clock::universal_time() - start).total_milliseconds();
-      if (elapsed > CHECKFORUPDATEMSEC){
-        break;
+      if (v.toBool()){
+        // changes are tracked against the floorplan as the editor exports it
+        self->m_exportIsMergeBase = true;
+        self->doExport(std::function<void()>());
+        return;
       }
-      // DLM: instead ignore user events
-      // DLM: this is a problem during file dialogs launched by the editor
-      OSAppBase::instance()->processEvents(QEventLoop::ExcludeUserInputEvents, processEventsTime);
-    }
 
-    //m_document->enable();
+      QString javascript = QString("window.api.openFloorplan(JSON.stringify(") + QString::fromStdString(json) + QString("), { noReloadGrid: true });");
+      //QString javascript = QString("window.api.importLibrary(JSON.stringify(") + QString::fromStdString(json) + QString("));");
+      self->m_view->page()->runJavaScript(javascript, [self](const QVariant &v) {
+        if (self){
+          // importing resets window.versionNumber
+          self->m_versionNumber = 0;
 
-    if (m_javascriptRunning){
-      // DLM: do not set this to false, we will require the javascript to complete
-      //m_javascriptRunning = false;
-    } else{
-      if (currentVersionNumber != m_versionNumber){
-        onChanged();
-      }
-    }
+          // changes are tracked against the floorplan as the editor exports it
+          self->m_exportIsMergeBase = true;
+          self->doExport(std::function<void()>());
+        }
+      });
+    });
   }
 }
 
@@ -655,16 +1089,14 @@ void GbXmlEditor::loadEditor()
   }
 
   m_editorLoaded = true;
-
-  // start checking for updates
-  //m_versionNumber = 0;
-  //m_checkForUpdateTimer->start(CHECKFORUPDATEMSEC);
-
 }
 
-void GbXmlEditor::doExport()
+void GbXmlEditor::doExport(const std::function<void()>& onExported)
 {
   // no-op since we aren't editing anything
+  if (onExported){
+    onExported();
+  }
 }
 
 void GbXmlEditor::saveExport()
@@ -709,11 +1141,6 @@ void GbXmlEditor::updateModel(const openstudio::model::Model& model)
   // no-op for now
 }
 
-void GbXmlEditor::checkForUpdate()
-{
-  // no-op since we aren't editing anything
-}
-
 IdfEditor::IdfEditor(const openstudio::path& idfPath, bool forceConvert, bool isIP, const openstudio::model::Model& model, QWebEngineView * view, QWidget *t_parent)
   : BaseEditor(isIP, model, view, t_parent),
   m_idfPath(idfPath)
@@ -823,16 +1250,14 @@ void IdfEditor::loadEditor()
   }
 
   m_editorLoaded = true;
-
-  // start checking for updates
-  //m_versionNumber = 0;
-  //m_checkForUpdateTimer->start(CHECKFORUPDATEMSEC);
-
 }
 
-void IdfEditor::doExport()
+void IdfEditor::doExport(const std::function<void()>& onExported)
 {
   // no-op since we aren't editing anything
+  if (onExported){
+    onExported();
+  }
 }
 
 void IdfEditor::saveExport()
@@ -877,11 +1302,6 @@ void IdfEditor::updateModel(const openstudio::model::Model& model)
   // no-op for now
 }
 
-void IdfEditor::checkForUpdate()
-{
-  // no-op since we aren't editing anything
-}
-
 OsmEditor::OsmEditor(const openstudio::path& osmPath, bool isIP, const openstudio::model::Model& model, QWebEngineView * view, QWidget *t_parent)
   : BaseEditor(isIP, model, view, t_parent),
     m_osmPath(osmPath)
@@ -943,16 +1363,14 @@ void OsmEditor::loadEditor()
   }
 
   m_editorLoaded = true;
-
-  // start checking for updates
-  //m_versionNumber = 0;
-  //m_checkForUpdateTimer->start(CHECKFORUPDATEMSEC);
-
 }
 
-void OsmEditor::doExport()
+void OsmEditor::doExport(const std::function<void()>& onExported)
 {
   // no-op since we aren't editing anything
+  if (onExported){
+    onExported();
+  }
 }
 
 void OsmEditor::saveExport()
@@ -970,11 +1388,6 @@ void OsmEditor::updateModel(const openstudio::model::Model& model)
   // no-op for now
 }
 
-void OsmEditor::checkForUpdate()
-{
-  // no-op since we aren't editing anything
-}
-
 
 EditorWebView::EditorWebView(bool isIP, const openstudio::model::Model& model, QWidget *t_parent)
   : QWidget(t_parent),
@@ -1092,6 +1505,7 @@ EditorWebView::EditorWebView(bool isIP, const openstudio::model::Model& model, Q
 
     m_baseEditor = new FloorspaceEditor(p, m_isIP, m_model, m_view, this);
     connect(m_baseEditor, &BaseEditor::changed, this, &EditorWebView::onChanged);
+    connect(m_baseEditor, &BaseEditor::translationReady, this, &EditorWebView::onTranslationReady);
     // editor will be started when page load finishes
     return;
   }
@@ -1146,10 +1560,6 @@ EditorWebView::EditorWebView(bool isIP, const openstudio::model::Model& model, Q
 
 EditorWebView::~EditorWebView()
 {
-  if (m_baseEditor && m_baseEditor->editorLoaded()){
-    m_baseEditor->blockUpdateTimerSignals(true);
-    m_baseEditor->checkForUpdate();
-  }
   if (m_mergeWarn){
     QSettings settings(QCoreApplication::organizationName(), QCoreApplication::applicationName());
     QString mergeWarnKeyName("geometryMergeWarn");
@@ -1161,7 +1571,8 @@ EditorWebView::~EditorWebView()
       msg.setEscapeButton(QMessageBox::No);
       int result = msg.exec();
       if (result == QMessageBox::Yes){
-        mergeClicked();
+        // no time for another export, merge the last one
+        mergeExport();
       } else if (result == QMessageBox::No){
         // no-op
       } else if (result == QMessageBox::Ignore){
@@ -1170,6 +1581,11 @@ EditorWebView::~EditorWebView()
     }
   }
   saveClickedBlocking("");
+
+  // editor uses the page
+  delete m_baseEditor;
+  m_baseEditor = nullptr;
+
   delete m_page;
   delete m_view;
 }
@@ -1199,6 +1615,7 @@ void EditorWebView::newImportClicked()
 
     m_baseEditor = new FloorspaceEditor(floorplanPath(), m_isIP, m_model, m_view, this);
     connect(m_baseEditor, &BaseEditor::changed, this, &EditorWebView::onChanged);
+    connect(m_baseEditor, &BaseEditor::translationReady, this, &EditorWebView::onTranslationReady);
     onChanged();
 
     // editor will be started when page load finishes
@@ -1298,8 +1715,8 @@ void EditorWebView::refreshClicked()
 
 void EditorWebView::saveClickedBlocking(const openstudio::path&)
 {
+  // the editor exports after each change, save the last export
   if (m_baseEditor && m_baseEditor->editorLoaded()){
-    m_baseEditor->doExport();
     m_baseEditor->saveExport();
   }
 }
@@ -1307,16 +1724,16 @@ void EditorWebView::saveClickedBlocking(const openstudio::path&)
 void EditorWebView::previewClicked()
 {
   if (m_baseEditor && m_baseEditor->editorLoaded()){
-    m_baseEditor->doExport();
-    previewExport();
+    m_previewBtn->setEnabled(false);
+    m_baseEditor->doExport([this]() { previewExport(); });
   }
 }
 
 void EditorWebView::mergeClicked()
 {
   if (m_baseEditor && m_baseEditor->editorLoaded()){
-    m_baseEditor->doExport();
-    mergeExport();
+    m_mergeBtn->setEnabled(false);
+    m_baseEditor->doExport([this]() { mergeExport(); });
   }
   m_mergeWarn = false;
 }
@@ -1327,21 +1744,243 @@ void EditorWebView::debugClicked()
   debugWebView.exec();
 }
 
-void EditorWebView::previewExport()
-{
-  if (m_baseEditor && m_baseEditor->editorLoaded()){
+namespace {
 
-    // do the export
-    m_baseEditor->doExport();
+  // surfaces of one space to take out of currentModel and to clone from the export model
+  struct SpaceSurfaceMerge
+  {
+    model::Space currentSpace;
+    model::Space newSpace;
+    bool edited;
+    std::vector<model::Surface> removedSurfaces;
+    std::vector<model::Surface> addedSurfaces;
+    std::vector<model::Surface> keptSurfaces;
+  };
+
+  // replaces the surfaces of the changed spaces with the ones of the matching spaces in the export model, and in their
+  // direct neighbours only the surfaces on the shared boundary, everything else is left alone. returns false without
+  // touching currentModel if the change reaches past the neighbours, ModelMerger takes it from there
+  bool mergeChangedSpaces(model::Model& currentModel, const model::Model& newModel, const std::map<UUID, UUID>& handleMapping, const std::set<UUID>& changedSpaces)
+  {
+    std::map<UUID, UUID> newToCurrentHandleMapping;
+    for (const auto& mapping : handleMapping){
+      newToCurrentHandleMapping[mapping.second] = mapping.first;
+    }
 
-    // translate the exported floorplan
-    m_baseEditor->translateExport();
+    // handle in currentModel of the space of a surface in either model
+    auto currentSpaceHandle = [&newToCurrentHandleMapping](const model::Surface& surface, bool isNew) -> boost::optional<UUID> {
+      boost::optional<model::Space> space = surface.space();
+      if (!space){
+        return boost::none;
+      }
+      if (!isNew){
+        return space->handle();
+      }
+      auto it = newToCurrentHandleMapping.find(space->handle());
+      if (it == newToCurrentHandleMapping.end()){
+        return boost::none;
+      }
+      return it->second;
+    };
+
+    std::map<UUID, SpaceSurfaceMerge> merges;
+
+    auto addSpace = [&](const UUID& handle, bool edited) -> bool {
+      auto it = handleMapping.find(handle);
+      if (it == handleMapping.end()){
+        return false;
+      }
+
+      boost::optional<model::Space> currentSpace = currentModel.getModelObject<model::Space>(handle);
+      boost::optional<model::Space> newSpace = newModel.getModelObject<model::Space>(it->second);
+      if (!currentSpace || !newSpace){
+        return false;
+      }
+
+      // anything beyond plain surfaces is left to ModelMerger
+      if (!newSpace->shadingSurfaceGroups().empty() || !newSpace->interiorPartitionSurfaceGroups().empty()){
+        return false;
+      }
+
+      merges.insert(std::make_pair(handle, SpaceSurfaceMerge{*currentSpace, *newSpace, edited, {}, {}, {}}));
+      return true;
+    };
+
+    for (const auto& handle : changedSpaces){
+      if (!addSpace(handle, true)){
+        return false;
+      }
+    }
+
+    // the direct neighbours of the edited spaces, in either model, the walk does not go any further
+    std::set<UUID> neighbours;
+    for (const auto& handle : changedSpaces){
+      const SpaceSurfaceMerge& merge = merges.at(handle);
+
+      for (const auto& surface : merge.currentSpace.surfaces()){
+        if (boost::optional<model::Surface> adjacentSurface = surface.adjacentSurface()){
+          boost::optional<UUID> adjacentSpace = currentSpaceHandle(*adjacentSurface, false);
+          if (adjacentSpace && !changedSpaces.count(*adjacentSpace)){
+            neighbours.insert(*adjacentSpace);
+          }
+        }
+      }
+      for (const auto& surface : merge.newSpace.surfaces()){
+        if (boost::optional<model::Surface> adjacentSurface = surface.adjacentSurface()){
+          boost::optional<UUID> adjacentSpace = currentSpaceHandle(*adjacentSurface, true);
+          if (!adjacentSpace){
+            return false;
+          }
+          if (!changedSpaces.count(*adjacentSpace)){
+            neighbours.insert(*adjacentSpace);
+          }
+        }
+      }
+    }
+
+    for (const auto& handle : neighbours){
+      if (!addSpace(handle, false)){
+        return false;
+      }
+    }
+
+    auto isAdjacentToEditedSpace = [&](const model::Surface& surface, bool isNew) {
+      if (boost::optional<model::Surface> adjacentSurface = surface.adjacentSurface()){
+        boost::optional<UUID> adjacentSpace = currentSpaceHandle(*adjacentSurface, isNew);
+        return adjacentSpace && (changedSpaces.count(*adjacentSpace) > 0);
+      }
+      return false;
+    };
+
+    for (auto& mergePair : merges){
+      SpaceSurfaceMerge& merge = mergePair.second;
+
+      if (merge.edited){
+        merge.removedSurfaces = merge.currentSpace.surfaces();
+        merge.addedSurfaces = merge.newSpace.surfaces();
+        continue;
+      }
+
+      // a neighbour keeps the surfaces the editor left as they were, away from the edited spaces. the space may have
+      // a new origin, so surfaces are compared in building coordinates
+      Transformation currentTransformation = merge.currentSpace.transformation();
+      Transformation newTransformation = merge.newSpace.transformation();
+      std::vector<model::Surface> newSurfaces = merge.newSpace.surfaces();
+      std::set<UUID> matchedNewSurfaces;
+      for (const auto& surface : merge.currentSpace.surfaces()){
+        bool kept = false;
+        if (!isAdjacentToEditedSpace(surface, false)){
+          for (const auto& newSurface : newSurfaces){
+            if (!matchedNewSurfaces.count(newSurface.handle()) && !isAdjacentToEditedSpace(newSurface, true) &&
+                circularEqual(currentTransformation * surface.vertices(), newTransformation * newSurface.vertices())){
+              matchedNewSurfaces.insert(newSurface.handle());
+              merge.keptSurfaces.push_back(surface);
+              kept = true;
+              break;
+            }
+          }
+        }
+
+        if (!kept){
+          // the surface matched to it, outside the edited spaces, would have to change as well
+          if (surface.adjacentSurface() && !isAdjacentToEditedSpace(surface, false)){
+            return false;
+          }
+          merge.removedSurfaces.push_back(surface);
+        }
+      }
+
+      for (const auto& newSurface : newSurfaces){
+        if (!matchedNewSurfaces.count(newSurface.handle())){
+          if (newSurface.adjacentSurface() && !isAdjacentToEditedSpace(newSurface, true)){
+            return false;
+          }
+          merge.addedSurfaces.push_back(newSurface);
+        }
+      }
+    }
+
+    for (auto& mergePair : merges){
+      for (auto& surface : mergePair.second.removedSurfaces){
+        surface.remove();
+      }
+    }
+
+    std::map<UUID, model::Surface> surfaceClones;
+    std::map<UUID, model::SubSurface> subSurfaceClones;
+    for (auto& mergePair : merges){
+      SpaceSurfaceMerge& merge = mergePair.second;
+
+      // clones are in the frame of the export, kept surfaces are moved into it so they stay where they are
+      Transformation currentTransformation = merge.currentSpace.transformation();
+      Transformation newTransformation = merge.newSpace.transformation();
+      if (currentTransformation.vector() != newTransformation.vector()){
+        Transformation toNewFrame = newTransformation.inverse() * currentTransformation;
+        for (auto& surface : merge.keptSurfaces){
+          surface.setVertices(toNewFrame * surface.vertices());
+          for (auto& subSurface : surface.subSurfaces()){
+            subSurface.setVertices(toNewFrame * subSurface.vertices());
+          }
+        }
+        merge.currentSpace.setTransformation(newTransformation);
+      }
+
+      for (const auto& newSurface : merge.addedSurfaces){
+        model::Surface clone = newSurface.clone(currentModel).cast<model::Surface>();
+        clone.setSpace(merge.currentSpace);
+        surfaceClones.insert(std::make_pair(newSurface.handle(), clone));
+
+        // sub surfaces are cloned along with their surface
+        std::vector<model::SubSurface> subSurfaceClonesOfSurface = clone.subSurfaces();
+        for (const auto& newSubSurface : newSurface.subSurfaces()){
+          for (const auto& subSurfaceClone : subSurfaceClonesOfSurface){
+            if (subSurfaceClone.vertices() == newSubSurface.vertices()){
+              subSurfaceClones.insert(std::make_pair(newSubSurface.handle(), subSurfaceClone));
+              break;
+            }
+          }
+        }
+      }
+    }
+
+    // restore surface matching between the clones, kept surfaces are only matched to other kept surfaces
+    for (const auto& mergePair : merges){
+      for (const auto& newSurface : mergePair.second.addedSurfaces){
+        boost::optional<model::Surface> adjacentSurface = newSurface.adjacentSurface();
+        if (adjacentSurface){
+          auto clone = surfaceClones.find(newSurface.handle());
+          auto adjacentClone = surfaceClones.find(adjacentSurface->handle());
+          if ((clone != surfaceClones.end()) && (adjacentClone != surfaceClones.end())){
+            clone->second.setAdjacentSurface(adjacentClone->second);
+          }
+        }
+
+        for (const auto& newSubSurface : newSurface.subSurfaces()){
+          boost::optional<model::SubSurface> adjacentSubSurface = newSubSurface.adjacentSubSurface();
+          if (adjacentSubSurface){
+            auto clone = subSurfaceClones.find(newSubSurface.handle());
+            auto adjacentClone = subSurfaceClones.find(adjacentSubSurface->handle());
+            if ((clone != subSurfaceClones.end()) && (adjacentClone != subSurfaceClones.end())){
+              clone->second.setAdjacentSubSurface(adjacentClone->second);
+            }
+          }
+        }
+      }
+    }
+
+    return true;
+  }
+
+  // merges the export of the editor into model, only the changed spaces when the editor knows them
+  QString mergeEditorExport(model::Model& model, const BaseEditor& editor)
+  {
+    boost::optional<std::set<UUID>> changedSpaces = editor.changedSpaces();
+    if (changedSpaces && mergeChangedSpaces(model, editor.exportModel(), editor.exportModelHandleMapping(), *changedSpaces)){
+      return QString();
+    }
 
-    // merge export model into clone of m_model
-    bool keepHandles = true;
-    model::Model temp = m_model.clone(keepHandles).cast<model::Model>();
     model::ModelMerger mm;
-    mm.mergeModels(temp, m_baseEditor->exportModel(), m_baseEditor->exportModelHandleMapping());
+    mm.mergeModels(model, editor.exportModel(), editor.exportModelHandleMapping());
 
     QString errorsAndWarnings;
     for (const auto& error : mm.errors()){
@@ -1350,6 +1989,22 @@ void EditorWebView::previewExport()
     for (const auto& warning : mm.warnings()){
       errorsAndWarnings += QString::fromStdString(warning.logMessage() + "\n");
     }
+    return errorsAndWarnings;
+  }
+
+}
+
+void EditorWebView::previewExport()
+{
+  if (m_baseEditor && m_baseEditor->editorLoaded()){
+
+    // translate the exported floorplan
+    m_baseEditor->translateExport();
+
+    // merge export model into clone of m_model
+    bool keepHandles = true;
+    model::Model temp = m_model.clone(keepHandles).cast<model::Model>();
+    QString errorsAndWarnings = mergeEditorExport(temp, *m_baseEditor);
     if (!errorsAndWarnings.isEmpty()){
       QMessageBox::warning(this, "Merging Models", errorsAndWarnings);
     }
@@ -1359,8 +2014,6 @@ void EditorWebView::previewExport()
     // save the exported floorplan
     m_baseEditor->saveExport();
 
-    bool signalsBlocked = m_baseEditor->blockUpdateTimerSignals(true);
-
     PreviewWebView* webView = new PreviewWebView(m_isIP, temp);
     QLayout* layout = new QVBoxLayout();
     layout->addWidget(webView);
@@ -1375,8 +2028,6 @@ void EditorWebView::previewExport()
     delete webView;
     delete layout;
 
-    m_baseEditor->blockUpdateTimerSignals(signalsBlocked);
-
     m_document->enable();
     m_previewBtn->setEnabled(true);
   }
@@ -1386,23 +2037,11 @@ void EditorWebView::mergeExport()
 {
   if (m_baseEditor && m_baseEditor->editorLoaded()){
 
-    // do the export
-    m_baseEditor->doExport();
-
     // translate the exported floorplan
     m_baseEditor->translateExport();
 
     // merge export model into m_model
-    model::ModelMerger mm;
-    mm.mergeModels(m_model, m_baseEditor->exportModel(), m_baseEditor->exportModelHandleMapping());
-
-    QString errorsAndWarnings;
-    for (const auto& error : mm.errors()){
-      errorsAndWarnings += QString::fromStdString(error.logMessage() + "\n");
-    }
-    for (const auto& warning : mm.warnings()){
-      errorsAndWarnings += QString::fromStdString(warning.logMessage() + "\n");
-    }
+    QString errorsAndWarnings = mergeEditorExport(m_model, *m_baseEditor);
     if (!errorsAndWarnings.isEmpty()){
       QMessageBox::warning(this, "Merging Models", errorsAndWarnings);
     } else{
@@ -1413,9 +2052,6 @@ void EditorWebView::mergeExport()
     // update the editor with merged model (potentially has new handles)
     m_baseEditor->updateModel(m_model);
 
-    // DLM: call doExport again just to be sure we get the freshest content
-    m_baseEditor->doExport();
-
     // save the exported floorplan
     m_baseEditor->saveExport();
 
@@ -1430,6 +2066,13 @@ void EditorWebView::onChanged()
   m_document->markAsModified();
 }
 
+void EditorWebView::onTranslationReady(bool ready)
+{
+  // merging or previewing now would wait on the translation
+  m_previewBtn->setEnabled(ready);
+  m_mergeBtn->setEnabled(ready);
+}
+
 void EditorWebView::onUnitSystemChange(bool t_isIP)
 {
   if (m_baseEditor){
@@ -42,10 +42,15 @@
 #include <QDialog>
 #include <QProgressBar>
 #include <QWebEngineView>
+#include <QFutureWatcher>
+
+#include <functional>
+#include <set>
 
 class QComboBox;
 class QPushButton;
 class QTimer;
+class QWebChannel;
 
 namespace openstudio {
 
@@ -91,18 +96,21 @@ class BaseEditor : public QObject
 
     bool editorLoaded() const;
     bool javascriptRunning() const;
-    bool blockUpdateTimerSignals(bool block);
 
     model::Model exportModel() const;
     std::map<UUID, UUID> exportModelHandleMapping() const;
 
+    // handles of the spaces in the current model changed by the export since the last merge, none if the whole export has to be merged
+    virtual boost::optional<std::set<UUID>> changedSpaces() const;
+
+    // exports the current content of the editor, onExported is called once the export is available
+    virtual void doExport(const std::function<void()>& onExported) = 0;
+    virtual void updateModel(const openstudio::model::Model& model) = 0;
+
   public slots:
     virtual void loadEditor() = 0;
-    virtual void doExport() = 0;
     virtual void saveExport() = 0;
     virtual void translateExport() = 0;
-    virtual void updateModel(const openstudio::model::Model& model) = 0;
-    virtual void checkForUpdate() = 0;
 
     virtual void onChanged();
 
@@ -110,6 +118,9 @@ class BaseEditor : public QObject
 
     bool changed();
 
+    // emitted by editors that translate their export in the background, ready is true once exportModel is current
+    void translationReady(bool ready);
+
   protected:
     bool m_editorLoaded;
     bool m_javascriptRunning;
@@ -124,7 +135,33 @@ class BaseEditor : public QObject
     std::map<UUID, UUID> m_exportModelHandleMapping;
 
     std::shared_ptr<OSDocument> m_document;
-    QTimer* m_checkForUpdateTimer;
+};
+
+// object published to the FloorspaceJS editor over a QWebChannel, the editor's onChange callback calls notifyChanged
+
+class FloorspaceChannel : public QObject
+{
+  Q_OBJECT;
+
+  public:
+    FloorspaceChannel(QObject *t_parent = nullptr);
+    virtual ~FloorspaceChannel() {}
+
+    Q_INVOKABLE void notifyChanged(unsigned versionNumber);
+
+  signals:
+    void changed(unsigned versionNumber);
+};
+
+// result of translating one export of the FloorspaceJS editor
+struct FloorplanTranslation
+{
+  unsigned exportNumber = 0;
+  boost::optional<FloorplanJS> floorplan;
+  boost::optional<model::Model> model;
+  std::map<UUID, UUID> handleMapping;
+  boost::optional<std::set<UUID>> changedSpaces;
+  QString errorsAndWarnings;
 };
 
 class FloorspaceEditor : public BaseEditor
@@ -135,18 +172,46 @@ class FloorspaceEditor : public BaseEditor
     FloorspaceEditor(const openstudio::path& floorplanPath, bool isIP, const openstudio::model::Model& model, QWebEngineView * m_view, QWidget *t_parent = nullptr);
     virtual ~FloorspaceEditor();
 
+    virtual void doExport(const std::function<void()>& onExported);
+    virtual void updateModel(const openstudio::model::Model& model);
+
+    virtual boost::optional<std::set<UUID>> changedSpaces() const;
+
   public slots:
     virtual void loadEditor();
-    virtual void doExport();
     virtual void saveExport();
     virtual void translateExport();
-    virtual void updateModel(const openstudio::model::Model& model);
-    virtual void checkForUpdate();
+
+  private slots:
+    void onEditorChanged(unsigned versionNumber);
+    void onExportTimeout();
+    void onTranslationFinished();
 
   private:
 
    openstudio::path m_floorplanPath;
    boost::optional<FloorplanJS> m_floorplan;
+
+   QWebChannel* m_webChannel;
+   FloorspaceChannel* m_channel;
+
+   // export shortly after the last change so saving always has current content
+   QTimer* m_exportTimer;
+
+   // translates m_export on a worker, if one is already running the latest export is translated when it finishes
+   void startTranslation();
+   void applyTranslation(const FloorplanTranslation& translation);
+
+   unsigned m_exportNumber;
+   unsigned m_translatedExportNumber;
+   bool m_translationPending;
+   QString m_translationErrorsAndWarnings;
+   QFutureWatcher<FloorplanTranslation> m_translationWatcher;
+
+   // export matching the current model, changes are tracked against it
+   QString m_mergedExport;
+   bool m_exportIsMergeBase;
+   boost::optional<std::set<UUID>> m_changedSpaces;
 };
 
 class GbXmlEditor : public BaseEditor
@@ -157,13 +222,13 @@ class GbXmlEditor : public BaseEditor
     GbXmlEditor(const openstudio::path& gbXmlPath, bool isIP, const openstudio::model::Model& model, QWebEngineView * m_view, QWidget *t_parent = nullptr);
     virtual ~GbXmlEditor();
 
+    virtual void doExport(const std::function<void()>& onExported);
+    virtual void updateModel(const openstudio::model::Model& model);
+
   public slots:
     virtual void loadEditor();
-    virtual void doExport();
     virtual void saveExport();
     virtual void translateExport();
-    virtual void updateModel(const openstudio::model::Model& model);
-    virtual void checkForUpdate();
 
   private:
 
@@ -179,13 +244,13 @@ class IdfEditor : public BaseEditor
     IdfEditor(const openstudio::path& idfPath, bool forceConvert, bool isIP, const openstudio::model::Model& model, QWebEngineView * m_view, QWidget *t_parent = nullptr);
     virtual ~IdfEditor();
 
+    virtual void doExport(const std::function<void()>& onExported);
+    virtual void updateModel(const openstudio::model::Model& model);
+
   public slots:
     virtual void loadEditor();
-    virtual void doExport();
     virtual void saveExport();
     virtual void translateExport();
-    virtual void updateModel(const openstudio::model::Model& model);
-    virtual void checkForUpdate();
 
   private:
 
@@ -201,13 +266,13 @@ class OsmEditor : public BaseEditor
     OsmEditor(const openstudio::path& osmPath, bool isIP, const openstudio::model::Model& model, QWebEngineView * m_view, QWidget *t_parent = nullptr);
     virtual ~OsmEditor();
 
+    virtual void doExport(const std::function<void()>& onExported);
+    virtual void updateModel(const openstudio::model::Model& model);
+
   public slots:
     virtual void loadEditor();
-    virtual void doExport();
     virtual void saveExport();
     virtual void translateExport();
-    virtual void updateModel(const openstudio::model::Model& model);
-    virtual void checkForUpdate();
 
   private:
 
@@ -237,6 +302,7 @@ class EditorWebView : public QWidget
     void previewExport();
     void mergeExport();
     void onChanged();
+    void onTranslationReady(bool ready);
 
     void 	onLoadFinished(bool ok);
     void 	onLoadProgress(int progress);
@@ -32,11 +32,49 @@
 #include "OSDocument.hpp"
 
 #include "../model_editor/Application.hpp"
+#include "../model_editor/Utilities.hpp"
 
 
 #include <openstudio/model/Model_Impl.hpp>
+#include <openstudio/model/ModelObject_Impl.hpp>
+#include <openstudio/model/PlanarSurface.hpp>
+#include <openstudio/model/PlanarSurface_Impl.hpp>
+#include <openstudio/model/Space.hpp>
+#include <openstudio/model/Space_Impl.hpp>
+#include <openstudio/model/Surface.hpp>
+#include <openstudio/model/Surface_Impl.hpp>
+#include <openstudio/model/SubSurface.hpp>
+#include <openstudio/model/SubSurface_Impl.hpp>
+#include <openstudio/model/ShadingSurface.hpp>
+#include <openstudio/model/ShadingSurfaceGroup.hpp>
+#include <openstudio/model/InteriorPartitionSurface.hpp>
+#include <openstudio/model/InteriorPartitionSurfaceGroup.hpp>
+#include <openstudio/model/PlanarSurfaceGroup.hpp>
+#include <openstudio/model/PlanarSurfaceGroup_Impl.hpp>
+#include <openstudio/model/ThermalZone.hpp>
+#include <openstudio/model/ThermalZone_Impl.hpp>
+#include <openstudio/model/SpaceType.hpp>
+#include <openstudio/model/SpaceType_Impl.hpp>
+#include <openstudio/model/BuildingStory.hpp>
+#include <openstudio/model/BuildingStory_Impl.hpp>
+#include <openstudio/model/BuildingUnit.hpp>
+#include <openstudio/model/BuildingUnit_Impl.hpp>
+#include <openstudio/model/Building.hpp>
+#include <openstudio/model/Building_Impl.hpp>
+#include <openstudio/model/ConstructionBase.hpp>
+#include <openstudio/model/ConstructionBase_Impl.hpp>
+#include <openstudio/model/DefaultConstructionSet.hpp>
+#include <openstudio/model/DefaultConstructionSet_Impl.hpp>
+#include <openstudio/model/DefaultSubSurfaceConstructions.hpp>
+#include <openstudio/model/DefaultSubSurfaceConstructions_Impl.hpp>
+#include <openstudio/model/DefaultSurfaceConstructions.hpp>
+#include <openstudio/model/DefaultSurfaceConstructions_Impl.hpp>
+#include <openstudio/model/RenderingColor.hpp>
+#include <openstudio/model/RenderingColor_Impl.hpp>
 #include <openstudio/model/ThreeJSForwardTranslator.hpp>
 
+#include <openstudio/OpenStudio.hxx>
+
 #include <openstudio/utilities/core/Assert.hpp>
 #include <openstudio/utilities/idd/IddEnums.hxx>
 
@@ -47,9 +85,20 @@
 #include <QFile>
 #include <QWebEngineSettings>
 #include <QWebEngineScriptCollection>
+#include <QWebChannel>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonArray>
+#include <QHash>
+#include <QDir>
+#include <QCryptographicHash>
 #include <QtConcurrent>
 
-using namespace std::placeholders;
+#include <algorithm>
+#include <sstream>
+
+// delay after the last model change before the preview is patched
+#define PATCH_DELAY_MSEC 500
 
 namespace openstudio {
 
@@ -74,12 +123,55 @@ GeometryPreviewView::~GeometryPreviewView()
 
 }
 
+PreviewSceneChannel::PreviewSceneChannel(QObject *t_parent)
+  : QObject(t_parent)
+{
+}
+
+void PreviewSceneChannel::setScene(const QVariantMap& scene)
+{
+  m_scene = scene;
+}
+
+QVariantMap PreviewSceneChannel::scene() const
+{
+  return m_scene;
+}
+
+void PreviewSceneChannel::sceneLoaded()
+{
+  emit loaded();
+}
+
+void PreviewSceneChannel::sendPatch(const QVariantMap& patch)
+{
+  emit patchReady(patch);
+}
+
+PreviewObjectWatcher::PreviewObjectWatcher(const model::ModelObject& modelObject, PreviewWebView* view)
+  : m_handle(modelObject.handle()),
+    m_view(view)
+{
+  modelObject.getImpl<model::detail::ModelObject_Impl>().get()->onChange.connect<PreviewObjectWatcher, &PreviewObjectWatcher::onChange>(this);
+}
+
+void PreviewObjectWatcher::onChange()
+{
+  m_view->onObjectChanged(m_handle);
+}
+
 PreviewWebView::PreviewWebView(bool isIP, const model::Model& model, QWidget *t_parent)
   : QWidget(t_parent),
     m_isIP(isIP),
     m_model(model),
     m_progressBar(new QProgressBar()),
-    m_refreshBtn(new QPushButton("Refresh"))
+    m_refreshBtn(new QPushButton("Refresh")),
+    m_webChannel(new QWebChannel(this)),
+    m_sceneChannel(new PreviewSceneChannel(this)),
+    m_translateCanceled(false),
+    m_sceneLoaded(false),
+    m_patchTimer(new QTimer(this)),
+    m_patchCanceled(false)
 {
 
   openstudio::OSAppBase * app = OSAppBase::instance();
@@ -121,6 +213,10 @@ PreviewWebView::PreviewWebView(bool isIP, const model::Model& model, QWidget *t_
   m_page = new OSWebEnginePage(this);
   m_view->setPage(m_page); // note, view does not take ownership of page
 
+  m_webChannel->registerObject(QStringLiteral("sceneChannel"), m_sceneChannel);
+  m_page->setWebChannel(m_webChannel);
+  connect(m_sceneChannel, &PreviewSceneChannel::loaded, this, &PreviewWebView::onSceneLoaded);
+
   connect(m_view, &QWebEngineView::loadFinished, this, &PreviewWebView::onLoadFinished);
   //connect(m_view, &QWebEngineView::loadProgress, this, &PreviewWebView::onLoadProgress);
   //connect(m_view, &QWebEngineView::loadStarted, this, &PreviewWebView::onLoadStarted);
@@ -135,11 +231,36 @@ PreviewWebView::PreviewWebView(bool isIP, const model::Model& model, QWidget *t_
   //mainLayout->addWidget(m_view, 10, Qt::AlignTop);
   mainLayout->addWidget(m_view);
 
+  connect(this, &PreviewWebView::translateProgress, this, &PreviewWebView::onTranslateProgress, Qt::QueuedConnection);
+  connect(&m_translateWatcher, &QFutureWatcher<QVariantMap>::finished, this, &PreviewWebView::onTranslateFinished);
+
+  // patch the preview as surfaces are added, removed, or changed
+  m_patchTimer->setSingleShot(true);
+  m_patchTimer->setInterval(PATCH_DELAY_MSEC);
+  connect(m_patchTimer, &QTimer::timeout, this, &PreviewWebView::onPatchTimeout);
+  connect(&m_patchWatcher, &QFutureWatcher<QVariantMap>::finished, this, &PreviewWebView::onPatchFinished);
+
+  m_model.getImpl<model::detail::Model_Impl>().get()->addWorkspaceObject.connect<PreviewWebView, &PreviewWebView::onObjectAdded>(this);
+  m_model.getImpl<model::detail::Model_Impl>().get()->removeWorkspaceObject.connect<PreviewWebView, &PreviewWebView::onObjectRemoved>(this);
+
+  for (const auto& planarSurface : m_model.getModelObjects<model::PlanarSurface>()){
+    watchObject(planarSurface);
+  }
+  for (const auto& planarSurfaceGroup : m_model.getModelObjects<model::PlanarSurfaceGroup>()){
+    watchObject(planarSurfaceGroup);
+  }
+
   m_view->load(QUrl("qrc:///library/geometry_preview.html"));
 }
 
 PreviewWebView::~PreviewWebView()
 {
+  // user left the tab, stop the translations at their next progress update
+  m_translateCanceled = true;
+  m_patchCanceled = true;
+  m_translateWatcher.waitForFinished();
+  m_patchWatcher.waitForFinished();
+
   delete m_view;
   delete m_page; 
 }
@@ -149,6 +270,16 @@ void PreviewWebView::refreshClicked()
   m_progressBar->setStyleSheet("");
   m_progressBar->setFormat("");
   m_progressBar->setTextVisible(false);
+  m_progressBar->setValue(0);
+  m_progressBar->setVisible(true);
+
+  // regenerate the whole scene, this covers any pending patches
+  m_scene.clear();
+  m_sceneLoaded = false;
+  m_changedHandles.clear();
+  m_removedHandles.clear();
+  m_patchTimer->stop();
+  m_patchCanceled = true;
 
   m_view->triggerPageAction(QWebEnginePage::ReloadAndBypassCache);
 }
@@ -177,24 +308,266 @@ void PreviewWebView::onLoadFinished(bool ok)
     return;
   }
 
-  if (m_json.isEmpty()){
-    std::function<void(double)> updatePercentage = std::bind(&PreviewWebView::onTranslateProgress, this, _1);
-    //ThreeScene scene = modelToThreeJS(m_model.clone(true).cast<model::Model>(), true, updatePercentage); // triangulated
+  if (m_scene.isEmpty()){
+    if (!m_translateWatcher.isRunning()){
+      startTranslation();
+    }
+  } else {
+    m_progressBar->setValue(90);
+    initScene();
+  }
+}
+
+namespace {
+
+  // thrown from the progress callback to abandon a translation
+  struct TranslationCanceled {};
+
+  // userData keys moved out of the scene json into the metadata table
+  const char* const metadataKeys[] = {"surfaceType", "constructionName", "thermalZoneName", "outsideBoundaryCondition"};
+
+  template <typename T>
+  QString toBase64(const std::vector<T>& values)
+  {
+    QByteArray bytes(reinterpret_cast<const char*>(values.data()), static_cast<int>(values.size() * sizeof(T)));
+    return QString::fromLatin1(bytes.toBase64());
+  }
+
+  // true for objects whose fields end up in the ThreeJS scene, default constructions resolve each surface's construction
+  bool isSceneObject(const model::ModelObject& modelObject)
+  {
+    return modelObject.optionalCast<model::PlanarSurface>() ||
+           modelObject.optionalCast<model::PlanarSurfaceGroup>() ||
+           modelObject.optionalCast<model::ThermalZone>() ||
+           modelObject.optionalCast<model::SpaceType>() ||
+           modelObject.optionalCast<model::BuildingStory>() ||
+           modelObject.optionalCast<model::BuildingUnit>() ||
+           modelObject.optionalCast<model::ConstructionBase>() ||
+           modelObject.optionalCast<model::DefaultConstructionSet>() ||
+           modelObject.optionalCast<model::DefaultSurfaceConstructions>() ||
+           modelObject.optionalCast<model::DefaultSubSurfaceConstructions>() ||
+           modelObject.optionalCast<model::Building>() ||
+           modelObject.optionalCast<model::RenderingColor>();
+  }
+
+  // Hash of the OpenStudio version and the full text of every scene object, ordered by handle. Two models with the same
+  // fingerprint translate to the same scene.
+  QString geometryFingerprint(const model::Model& model)
+  {
+    std::vector<model::ModelObject> modelObjects;
+    for (const auto& modelObject : model.getModelObjects<model::ModelObject>()){
+      if (isSceneObject(modelObject)){
+        modelObjects.push_back(modelObject);
+      }
+    }
+    std::sort(modelObjects.begin(), modelObjects.end(), [](const model::ModelObject& a, const model::ModelObject& b) {
+      return a.handle() < b.handle();
+    });
+
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(QByteArray::fromStdString(openStudioLongVersion()));
+    for (const auto& modelObject : modelObjects){
+      std::stringstream ss;
+      ss << modelObject.idfObject();
+      hash.addData(QByteArray::fromStdString(ss.str()));
+    }
+
+    return QString::fromLatin1(hash.result().toHex());
+  }
+
+  QVariantMap loadCachedScene(const QString& cachePath)
+  {
+    QFile file(cachePath);
+    if (!file.open(QIODevice::ReadOnly)){
+      return QVariantMap();
+    }
+    return QJsonDocument::fromJson(file.readAll()).object().toVariantMap();
+  }
+
+  // writes the scene and removes the entries for older fingerprints
+  void saveCachedScene(const QString& cacheDir, const QString& cachePath, const QVariantMap& scene)
+  {
+    QDir dir(cacheDir);
+    if (!dir.mkpath(".")){
+      return;
+    }
+
+    for (const QString& entry : dir.entryList(QStringList("*.json"), QDir::Files)){
+      dir.remove(entry);
+    }
+
+    QFile file(cachePath);
+    if (file.open(QIODevice::WriteOnly)){
+      file.write(QJsonDocument(QJsonObject::fromVariantMap(scene)).toJson(QJsonDocument::Compact));
+    }
+  }
+
+  // Splits the ThreeJS scene json into a small json document, packed Float32 vertex and Uint32 index buffers, and a
+  // string table for the metadataKeys. The buffers are base64 encoded since the web channel only carries json.
+  // Returns the unpacked json if any geometry is not triangulated.
+  QVariantMap packScene(const std::string& json)
+  {
+    QVariantMap result;
+
+    QJsonObject root = QJsonDocument::fromJson(QByteArray::fromStdString(json)).object();
+
+    std::vector<float> positions;
+    std::vector<quint32> indices;
+    std::vector<quint32> geometryTable; // vertex offset, vertex count, index offset, index count
+    QJsonArray geometries = root["geometries"].toArray();
+    for (int i = 0; i < geometries.size(); ++i){
+      QJsonObject geometry = geometries[i].toObject();
+      QJsonObject data = geometry["data"].toObject();
+      QJsonArray vertices = data["vertices"].toArray();
+      QJsonArray faces = data["faces"].toArray();
+
+      geometryTable.push_back(static_cast<quint32>(positions.size() / 3));
+      geometryTable.push_back(static_cast<quint32>(vertices.size() / 3));
+      geometryTable.push_back(static_cast<quint32>(indices.size()));
+
+      for (const QJsonValue& vertex : vertices){
+        positions.push_back(static_cast<float>(vertex.toDouble()));
+      }
+
+      // three.js Geometry face format, a type flag followed by the vertex indices, 0 is a plain triangle
+      for (int j = 0; j < faces.size(); j += 4){
+        if ((faces[j].toInt() != 0) || (j + 3 >= faces.size())){
+          result["json"] = QString::fromStdString(json);
+          return result;
+        }
+        indices.push_back(static_cast<quint32>(faces[j + 1].toInt()));
+        indices.push_back(static_cast<quint32>(faces[j + 2].toInt()));
+        indices.push_back(static_cast<quint32>(faces[j + 3].toInt()));
+      }
+
+      geometryTable.push_back(static_cast<quint32>(indices.size()) - geometryTable.back());
+
+      data.remove("vertices");
+      data.remove("faces");
+      geometry["data"] = data;
+      geometries[i] = geometry;
+    }
+    root["geometries"] = geometries;
+
+    QStringList strings;
+    QHash<QString, quint32> stringIndices;
+    QVariantMap columns;
+    QJsonObject object = root["object"].toObject();
+    QJsonArray children = object["children"].toArray();
+    for (const char* key : metadataKeys){
+      std::vector<quint32> column;
+      column.reserve(children.size());
+      for (int i = 0; i < children.size(); ++i){
+        QJsonObject child = children[i].toObject();
+        QJsonObject userData = child["userData"].toObject();
+        QString value = userData.take(key).toString();
+
+        auto it = stringIndices.find(value);
+        if (it == stringIndices.end()){
+          it = stringIndices.insert(value, static_cast<quint32>(strings.size()));
+          strings << value;
+        }
+        column.push_back(it.value());
+
+        child["userData"] = userData;
+        children[i] = child;
+      }
+      columns[key] = toBase64(column);
+    }
+    object["children"] = children;
+    root["object"] = object;
+
+    result["json"] = QString::fromUtf8(QJsonDocument(root).toJson(QJsonDocument::Compact));
+    result["positions"] = toBase64(positions);
+    result["indices"] = toBase64(indices);
+    result["geometries"] = toBase64(geometryTable);
+    result["strings"] = strings;
+    result["columns"] = columns;
+    return result;
+  }
+
+}
+
+void PreviewWebView::startTranslation()
+{
+  // the worker translates its own copy so the model can be edited while it runs
+  model::Model snapshot = m_model.clone(true).cast<model::Model>();
 
+  // scenes are cached in the companion folder so reopening the model skips the translation
+  QString cacheDir = m_document->modelTempDir() + "/resources/preview";
+
+  m_translateCanceled = false;
+  m_translateWatcher.setFuture(QtConcurrent::run(this, &PreviewWebView::translateScene, snapshot, cacheDir));
+}
+
+QVariantMap PreviewWebView::translateScene(model::Model model, QString cacheDir)
+{
+  QString cachePath = cacheDir + "/" + geometryFingerprint(model) + ".json";
+
+  QVariantMap result = loadCachedScene(cachePath);
+  if (!result.isEmpty()){
+    LOG(Debug, "Loaded cached scene '" << toString(cachePath) << "'");
+    return result;
+  }
+
+  result = translateModel(model, m_translateCanceled);
+  if (!result.isEmpty()){
+    saveCachedScene(cacheDir, cachePath, result);
+  }
+
+  return result;
+}
+
+QVariantMap PreviewWebView::translateModel(model::Model model, const std::atomic<bool>& canceled)
+{
+  std::function<void(double)> updatePercentage = [this, &canceled](double percentage) {
+    if (canceled){
+      throw TranslationCanceled();
+    }
+    emit translateProgress(percentage);
+  };
+
+  try {
     model::ThreeJSForwardTranslator ft;
-    ThreeScene scene = ft.modelToThreeJS(m_model, true, updatePercentage); // triangulated
+    ThreeScene scene = ft.modelToThreeJS(model, true, updatePercentage); // triangulated
+    if (canceled){
+      return QVariantMap();
+    }
     std::string json = scene.toJSON(false); // no pretty print
-    m_json = QString::fromStdString(json);
-  } else {
-    m_progressBar->setValue(90);
+    return packScene(json);
+  } catch (const TranslationCanceled&) {
+    LOG(Debug, "Translation canceled");
+  }
+
+  return QVariantMap();
+}
+
+void PreviewWebView::onTranslateFinished()
+{
+  if (m_translateCanceled){
+    return;
+  }
+
+  m_scene = m_translateWatcher.result();
+  if (m_scene.isEmpty()){
+    m_progressBar->setValue(100);
+    m_progressBar->setStyleSheet("QProgressBar::chunk {background-color: #FF0000;}");
+    m_progressBar->setFormat("Error");
+    m_progressBar->setTextVisible(true);
+    return;
   }
 
+  initScene();
+}
+
+void PreviewWebView::initScene()
+{
   // disable doc
   m_document->disable();
 
-  // call init and animate
-  QString javascript = QString("init(") + m_json + QString(");\n animate();\n initDatGui();");
-  m_view->page()->runJavaScript(javascript, [this](const QVariant &v) { onJavaScriptFinished(v); });
+  // viewer pulls the scene, calls init and animate, then calls sceneLoaded
+  m_sceneChannel->setScene(m_scene);
+  m_view->page()->runJavaScript("initFromChannel();");
 
   //javascript = QString("os_data.metadata.version");
   //m_view->page()->runJavaScript(javascript, [](const QVariant &v) { callWithResult(v.toString()); });
@@ -212,14 +585,249 @@ void PreviewWebView::onLoadFinished(bool ok)
 void PreviewWebView::onTranslateProgress(double percentage)
 {
   m_progressBar->setValue(10 + 0.8*percentage);
-  OSAppBase::instance()->processEvents(QEventLoop::ExcludeUserInputEvents, 200);
 }
 
-void PreviewWebView::onJavaScriptFinished(const QVariant &v)
+void PreviewWebView::onSceneLoaded()
 {
   m_document->enable();
   m_progressBar->setValue(100);
   m_progressBar->setVisible(false);
+
+  m_sceneLoaded = true;
+  if (!m_changedHandles.empty() || !m_removedHandles.empty()){
+    m_patchTimer->start();
+  }
+}
+
+void PreviewWebView::watchObject(const model::ModelObject& modelObject)
+{
+  if (modelObject.optionalCast<model::PlanarSurface>() || modelObject.optionalCast<model::PlanarSurfaceGroup>()){
+    m_objectWatchers[modelObject.handle()] = std::unique_ptr<PreviewObjectWatcher>(new PreviewObjectWatcher(modelObject, this));
+  }
+}
+
+void PreviewWebView::onObjectAdded(const WorkspaceObject& workspaceObject, const openstudio::IddObjectType& type, const openstudio::UUID& uuid)
+{
+  if (workspaceObject.optionalCast<model::PlanarSurface>() || workspaceObject.optionalCast<model::PlanarSurfaceGroup>()){
+    watchObject(workspaceObject.cast<model::ModelObject>());
+    onObjectChanged(workspaceObject.handle());
+  }
+}
+
+void PreviewWebView::onObjectRemoved(const WorkspaceObject& workspaceObject, const openstudio::IddObjectType& type, const openstudio::UUID& uuid)
+{
+  auto it = m_objectWatchers.find(workspaceObject.handle());
+  if (it == m_objectWatchers.end()){
+    return;
+  }
+  m_objectWatchers.erase(it);
+
+  if (workspaceObject.optionalCast<model::PlanarSurface>()){
+    m_removedHandles.insert(workspaceObject.handle());
+    m_changedHandles.erase(workspaceObject.handle());
+
+    // the base surface loses a hole
+    if (boost::optional<model::SubSurface> subSurface = workspaceObject.optionalCast<model::SubSurface>()){
+      if (boost::optional<model::Surface> surface = subSurface->surface()){
+        m_changedHandles.insert(surface->handle());
+      }
+    }
+
+    m_patchTimer->start();
+  }
+}
+
+void PreviewWebView::onObjectChanged(const Handle& handle)
+{
+  m_changedHandles.insert(handle);
+  m_patchTimer->start();
+}
+
+std::set<Handle> PreviewWebView::patchSurfaces() const
+{
+  std::set<Handle> result;
+  for (const Handle& handle : m_changedHandles){
+    boost::optional<model::ModelObject> modelObject = m_model.getModelObject<model::ModelObject>(handle);
+    if (!modelObject){
+      continue;
+    }
+
+    // moving a space moves all of its surfaces
+    if (boost::optional<model::Space> space = modelObject->optionalCast<model::Space>()){
+      for (const auto& surface : space->surfaces()){
+        result.insert(surface.handle());
+      }
+      for (const auto& group : space->shadingSurfaceGroups()){
+        for (const auto& shadingSurface : group.shadingSurfaces()){
+          result.insert(shadingSurface.handle());
+        }
+      }
+      for (const auto& group : space->interiorPartitionSurfaceGroups()){
+        for (const auto& partition : group.interiorPartitionSurfaces()){
+          result.insert(partition.handle());
+        }
+      }
+    } else if (boost::optional<model::ShadingSurfaceGroup> group = modelObject->optionalCast<model::ShadingSurfaceGroup>()){
+      for (const auto& shadingSurface : group->shadingSurfaces()){
+        result.insert(shadingSurface.handle());
+      }
+    } else if (boost::optional<model::InteriorPartitionSurfaceGroup> group = modelObject->optionalCast<model::InteriorPartitionSurfaceGroup>()){
+      for (const auto& partition : group->interiorPartitionSurfaces()){
+        result.insert(partition.handle());
+      }
+    } else if (modelObject->optionalCast<model::PlanarSurface>()){
+      result.insert(handle);
+    }
+  }
+
+  // adjacent surfaces carry the boundary condition metadata, sub surfaces need their base surface
+  std::set<Handle> changed = result;
+  for (const Handle& handle : changed){
+    if (boost::optional<model::Surface> surface = m_model.getModelObject<model::Surface>(handle)){
+      if (boost::optional<model::Surface> adjacentSurface = surface->adjacentSurface()){
+        result.insert(adjacentSurface->handle());
+      }
+    } else if (boost::optional<model::SubSurface> subSurface = m_model.getModelObject<model::SubSurface>(handle)){
+      if (boost::optional<model::Surface> surface = subSurface->surface()){
+        result.insert(surface->handle());
+      }
+      if (boost::optional<model::SubSurface> adjacentSubSurface = subSurface->adjacentSubSurface()){
+        result.insert(adjacentSubSurface->handle());
+        if (boost::optional<model::Surface> surface = adjacentSubSurface->surface()){
+          result.insert(surface->handle());
+        }
+      }
+    }
+  }
+
+  // base surfaces are triangulated around all of their sub surfaces
+  changed = result;
+  for (const Handle& handle : changed){
+    if (boost::optional<model::Surface> surface = m_model.getModelObject<model::Surface>(handle)){
+      for (const auto& subSurface : surface->subSurfaces()){
+        result.insert(subSurface.handle());
+      }
+    }
+  }
+
+  return result;
+}
+
+std::vector<Handle> PreviewWebView::patchObjects(const std::set<Handle>& surfaces) const
+{
+  std::set<Handle> result;
+
+  auto addWithResources = [&result](const model::ModelObject& modelObject) {
+    if (result.insert(modelObject.handle()).second){
+      for (const auto& resource : modelObject.resources()){
+        result.insert(resource.handle());
+      }
+    }
+  };
+
+  // the translator places spaces and groups relative to the building and colors surfaces by construction, space
+  // type, zone, story and unit, default construction sets come with the resources of the space, story and building
+  if (boost::optional<model::Building> building = m_model.building()){
+    addWithResources(*building);
+  }
+
+  for (const Handle& handle : surfaces){
+    boost::optional<model::PlanarSurface> planarSurface = m_model.getModelObject<model::PlanarSurface>(handle);
+    if (!planarSurface){
+      continue;
+    }
+    addWithResources(*planarSurface);
+
+    boost::optional<model::Space> space = planarSurface->space();
+    if (boost::optional<model::PlanarSurfaceGroup> group = planarSurface->planarSurfaceGroup()){
+      addWithResources(*group);
+    }
+
+    if (!space){
+      continue;
+    }
+    addWithResources(*space);
+    if (boost::optional<model::ThermalZone> thermalZone = space->thermalZone()){
+      addWithResources(*thermalZone);
+    }
+    if (boost::optional<model::BuildingStory> buildingStory = space->buildingStory()){
+      addWithResources(*buildingStory);
+    }
+    if (boost::optional<model::BuildingUnit> buildingUnit = space->buildingUnit()){
+      addWithResources(*buildingUnit);
+    }
+  }
+
+  return std::vector<Handle>(result.begin(), result.end());
+}
+
+void PreviewWebView::onPatchTimeout()
+{
+  // picked up again when the scene is loaded or the running patch finishes
+  if (!m_sceneLoaded || m_patchWatcher.isRunning()){
+    return;
+  }
+
+  if (m_changedHandles.empty() && m_removedHandles.empty()){
+    return;
+  }
+
+  std::set<Handle> surfaces = patchSurfaces();
+
+  m_patchHandles.clear();
+  for (const Handle& handle : surfaces){
+    m_patchHandles << toQString(handle);
+  }
+  for (const Handle& handle : m_removedHandles){
+    m_patchHandles << toQString(handle);
+  }
+  m_changedHandles.clear();
+  m_removedHandles.clear();
+
+  if (surfaces.empty()){
+    QVariantMap patch;
+    patch["replaced"] = m_patchHandles;
+    m_sceneChannel->sendPatch(patch);
+    return;
+  }
+
+  // the worker gets its own copy as in startTranslation, but only of the surfaces to patch and what they refer to
+  model::Model snapshot = m_model.cloneSubset(patchObjects(surfaces), true).cast<model::Model>();
+
+  m_patchCanceled = false;
+  m_patchWatcher.setFuture(QtConcurrent::run(this, &PreviewWebView::translatePatch, snapshot, surfaces));
+}
+
+QVariantMap PreviewWebView::translatePatch(model::Model model, std::set<Handle> surfaces)
+{
+  std::vector<Handle> removeHandles;
+  for (const auto& planarSurface : model.getModelObjects<model::PlanarSurface>()){
+    if (surfaces.find(planarSurface.handle()) == surfaces.end()){
+      removeHandles.push_back(planarSurface.handle());
+    }
+  }
+  model.removeObjects(removeHandles);
+
+  return translateModel(model, m_patchCanceled);
+}
+
+void PreviewWebView::onPatchFinished()
+{
+  if (m_patchCanceled){
+    return;
+  }
+
+  QVariantMap patch = m_patchWatcher.result();
+  if (patch.isEmpty()){
+    LOG(Error, "Failed to translate preview patch");
+  } else if (m_sceneLoaded){
+    patch["replaced"] = m_patchHandles;
+    m_sceneChannel->sendPatch(patch);
+  }
+
+  if (!m_changedHandles.empty() || !m_removedHandles.empty()){
+    m_patchTimer->start();
+  }
 }
 
 void PreviewWebView::onRenderProcessTerminated(QWebEnginePage::RenderProcessTerminationStatus terminationStatus, int exitCode)
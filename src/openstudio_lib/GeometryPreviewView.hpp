@@ -36,16 +36,29 @@
 
 #include <openstudio/model/Model.hpp>
 
+#include <openstudio/nano/nano_signal_slot.hpp> // Signal-Slot replacement
+
 #include <QWidget>
 #include <QWebEngineView>
 #include <QProgressBar>
+#include <QFutureWatcher>
+#include <QVariantMap>
+#include <QTimer>
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <set>
+#include <vector>
 
 class QComboBox;
 class QPushButton;
+class QWebChannel;
 
 namespace openstudio {
 
 class OSDocument;
+class PreviewWebView;
 
 class GeometryPreviewView : public QWidget
 {
@@ -63,9 +76,52 @@ class GeometryPreviewView : public QWidget
 
 };
 
+// object published to the viewer over a QWebChannel, the viewer pulls the packed scene from it
+
+class PreviewSceneChannel : public QObject
+{
+  Q_OBJECT;
+
+  public:
+    PreviewSceneChannel(QObject *t_parent = nullptr);
+    virtual ~PreviewSceneChannel() {}
+
+    void setScene(const QVariantMap& scene);
+
+    // called by the viewer
+    Q_INVOKABLE QVariantMap scene() const;
+    Q_INVOKABLE void sceneLoaded();
+
+    // pushes a scene patch to the viewer
+    void sendPatch(const QVariantMap& patch);
+
+  signals:
+    void loaded();
+
+    // packed scene with the translated objects, plus the list of handles the patch replaces
+    void patchReady(const QVariantMap& patch);
+
+  private:
+    QVariantMap m_scene;
+};
+
+// forwards onChange of a planar surface or space to the preview
+
+class PreviewObjectWatcher : public Nano::Observer
+{
+  public:
+    PreviewObjectWatcher(const model::ModelObject& modelObject, PreviewWebView* view);
+
+    void onChange();
+
+  private:
+    Handle m_handle;
+    PreviewWebView* m_view;
+};
+
 // main widget
 
-class PreviewWebView : public QWidget
+class PreviewWebView : public QWidget, public Nano::Observer
 {
   Q_OBJECT;
 
@@ -73,9 +129,16 @@ class PreviewWebView : public QWidget
     PreviewWebView(bool isIP, const openstudio::model::Model& model, QWidget *t_parent = nullptr);
     virtual ~PreviewWebView();
 
+    // called by PreviewObjectWatcher, schedules a patch for the object
+    void onObjectChanged(const Handle& handle);
+
   public slots:
     void onUnitSystemChange(bool t_isIP);
 
+  signals:
+    // emitted from the translation thread
+    void translateProgress(double percentage);
+
   private slots:
     void refreshClicked();
 
@@ -84,11 +147,42 @@ class PreviewWebView : public QWidget
     //void 	onLoadProgress(int progress);
     //void 	onLoadStarted();
     void 	onTranslateProgress(double percentage);
-    void 	onJavaScriptFinished(const QVariant &v);
+    void 	onTranslateFinished();
+    void 	onSceneLoaded();
+    void 	onPatchTimeout();
+    void 	onPatchFinished();
     void 	onRenderProcessTerminated(QWebEnginePage::RenderProcessTerminationStatus terminationStatus, int exitCode);
   private:
     REGISTER_LOGGER("openstudio::PreviewWebView");
 
+    // translates a snapshot of m_model on a worker thread, onTranslateFinished is called when done
+    void startTranslation();
+
+    // runs on the worker thread, loads the scene from cacheDir if the geometry fingerprint matches
+    QVariantMap translateScene(model::Model model, QString cacheDir);
+
+    // runs on the worker thread, returns an empty map if canceled is set
+    QVariantMap translateModel(model::Model model, const std::atomic<bool>& canceled);
+
+    // asks the viewer to pull m_scene from the web channel
+    void initScene();
+
+    void onObjectAdded(const WorkspaceObject& workspaceObject, const openstudio::IddObjectType& type, const openstudio::UUID& uuid);
+
+    void onObjectRemoved(const WorkspaceObject& workspaceObject, const openstudio::IddObjectType& type, const openstudio::UUID& uuid);
+
+    // connects onChange of planar surfaces and their groups, which carry the transformation
+    void watchObject(const model::ModelObject& modelObject);
+
+    // planar surfaces to retranslate for m_changedHandles, includes adjacent surfaces and the sub surfaces of base surfaces
+    std::set<Handle> patchSurfaces() const;
+
+    // surfaces plus their groups, spaces, and what the translator reads from them, copied into the patch snapshot
+    std::vector<Handle> patchObjects(const std::set<Handle>& surfaces) const;
+
+    // runs on the worker thread, translates only the planar surfaces in surfaces
+    QVariantMap translatePatch(model::Model model, std::set<Handle> surfaces);
+
     bool m_isIP;
     model::Model m_model;
 
@@ -99,7 +193,25 @@ class PreviewWebView : public QWidget
     OSWebEnginePage * m_page;
     std::shared_ptr<OSDocument> m_document;
 
-    QString m_json;
+    QWebChannel * m_webChannel;
+    PreviewSceneChannel * m_sceneChannel;
+
+    // packed scene, see packScene
+    QVariantMap m_scene;
+
+    QFutureWatcher<QVariantMap> m_translateWatcher;
+    std::atomic<bool> m_translateCanceled;
+
+    // true once the viewer has loaded m_scene, patches are only sent after that
+    bool m_sceneLoaded;
+
+    std::map<Handle, std::unique_ptr<PreviewObjectWatcher> > m_objectWatchers;
+    std::set<Handle> m_changedHandles;
+    std::set<Handle> m_removedHandles;
+    QTimer * m_patchTimer;
+    QFutureWatcher<QVariantMap> m_patchWatcher;
+    std::atomic<bool> m_patchCanceled;
+    QStringList m_patchHandles;
 };
 
 } // openstudio
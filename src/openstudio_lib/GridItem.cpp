@@ -40,6 +40,7 @@
 #include <openstudio/utilities/core/Compare.hpp>
 
 #include <QPainter>
+#include <QStyleOptionGraphicsItem>
 #include <QMimeData>
 #include <QGraphicsSceneDragDropEvent>
 #include <QKeyEvent>
@@ -121,6 +122,31 @@ using namespace openstudio::model;
 
 namespace openstudio {
 
+// Below this scale component icons are drawn as plain boxes and node setpoint icons are left out,
+// a large loop zoomed out to fit the view has icons only a few pixels wide
+const double DETAILLEVELOFDETAIL = 0.4;
+
+bool drawDetail(QPainter * painter)
+{
+  return QStyleOptionGraphicsItem::levelOfDetailFromTransform(painter->worldTransform()) >= DETAILLEVELOFDETAIL;
+}
+
+void drawComponentIcon(QPainter * painter, qreal x, qreal y, qreal w, qreal h, const QPixmap & pixmap)
+{
+  if( drawDetail(painter) )
+  {
+    painter->drawPixmap(QRectF(x,y,w,h),pixmap,QRectF(pixmap.rect()));
+  }
+  else
+  {
+    painter->save();
+    painter->setPen(Qt::NoPen);
+    painter->setBrush(QBrush(QColor(96,96,96),Qt::SolidPattern));
+    painter->drawRect(QRectF(x,y,w,h));
+    painter->restore();
+  }
+}
+
 bool hasSPM(model::Node & node)
 {
   /* // Previously was only allowing temperature
@@ -262,6 +288,13 @@ void ModelObjectGraphicsItem::setModelObject( model::OptionalModelObject modelOb
 
     setFlag(QGraphicsItem::ItemIsSelectable);
 
+    // A component's drawing only depends on its type, so it is rendered once per zoom level rather than on every repaint.
+    // Nodes show setpoint managers that can change without the scene being laid out again.
+    if( !m_modelObject->optionalCast<model::Node>() )
+    {
+      setCacheMode(QGraphicsItem::DeviceCoordinateCache);
+    }
+
     this->onNameChange();
   }
 }
@@ -494,7 +527,7 @@ void HalfHeightOneThreeStraightItem::paint(QPainter *painter, const QStyleOption
   if( modelObject() )
   {
     const QPixmap * qPixmap = IconLibrary::Instance().findIcon( modelObject()->iddObject().type().value() );
-    painter->drawPixmap(37,12,25,25,*qPixmap);
+    drawComponentIcon(painter,37,12,25,25,*qPixmap);
   }
 }
 
@@ -1722,7 +1755,7 @@ void OneThreeDualDuctMixerItem::paint(QPainter *painter, const QStyleOptionGraph
   if( modelObject() )
   {
     const QPixmap * qPixmap = IconLibrary::Instance().findIcon( modelObject()->iddObject().type().value() );
-    painter->drawPixmap(0,0,100,100,*qPixmap);
+    drawComponentIcon(painter,0,0,100,100,*qPixmap);
   }
 }
 
@@ -1748,7 +1781,7 @@ void OneThreeStraightItem::paint(QPainter *painter, const QStyleOptionGraphicsIt
   if( modelObject() )
   {
     const QPixmap * qPixmap = IconLibrary::Instance().findIcon( modelObject()->iddObject().type().value() );
-    painter->drawPixmap(12,12,75,75,*qPixmap);
+    drawComponentIcon(painter,12,12,75,75,*qPixmap);
 
     //if(m_deleteAble)
     //{
@@ -1832,7 +1865,7 @@ void OneThreeWaterToAirItem::paint(QPainter *painter, const QStyleOptionGraphics
   if( modelObject() )
   {
     const QPixmap * qPixmap = IconLibrary::Instance().findIcon( modelObject()->iddObject().type().value() );
-    painter->drawPixmap(12,12,75,75,*qPixmap);
+    drawComponentIcon(painter,12,12,75,75,*qPixmap);
 
     //if(m_deleteAble)
     //{
@@ -1916,7 +1949,7 @@ void OneThreeWaterToWaterItem::paint(QPainter *painter, const QStyleOptionGraphi
   if( modelObject() )
   {
     const QPixmap * qPixmap = IconLibrary::Instance().findIcon( modelObject()->iddObject().type().value() );
-    painter->drawPixmap(12,12,75,75,*qPixmap);
+    drawComponentIcon(painter,12,12,75,75,*qPixmap);
 
     //if(m_deleteAble)
     //{
@@ -1963,7 +1996,7 @@ void TwoFourStraightItem::paint(QPainter *painter, const QStyleOptionGraphicsIte
     painter->rotate(90);
 
     const QPixmap * qPixmap = IconLibrary::Instance().findIcon( modelObject()->iddObject().type().value() );
-    painter->drawPixmap(12,12,75,75,*qPixmap);
+    drawComponentIcon(painter,12,12,75,75,*qPixmap);
 
     painter->rotate(-90);
     painter->translate(-100,0);
@@ -2009,7 +2042,7 @@ void OASupplyStraightItem::paint(QPainter *painter, const QStyleOptionGraphicsIt
     painter->rotate(90);
 
     const QPixmap * qPixmap = IconLibrary::Instance().findIcon( modelObject()->iddObject().type().value() );
-    painter->drawPixmap(12,12,75,75,*qPixmap);
+    drawComponentIcon(painter,12,12,75,75,*qPixmap);
 
     painter->rotate(-90);
     painter->translate(-100,0);
@@ -2068,7 +2101,7 @@ void OAReliefStraightItem::paint(QPainter *painter, const QStyleOptionGraphicsIt
     painter->rotate(-90);
 
     const QPixmap * qPixmap = IconLibrary::Instance().findIcon( modelObject()->iddObject().type().value() );
-    painter->drawPixmap(12,12,75,75,*qPixmap);
+    drawComponentIcon(painter,12,12,75,75,*qPixmap);
 
     painter->rotate(90);
     painter->translate(0,-100);
@@ -2135,7 +2168,7 @@ void OAAirToAirItem::paint(QPainter *painter,
   if( modelObject() )
   {
     const QPixmap * qPixmap = IconLibrary::Instance().findIcon( modelObject()->iddObject().type().value() );
-    painter->drawPixmap(0,0,200,100,*qPixmap);
+    drawComponentIcon(painter,0,0,200,100,*qPixmap);
   }
 }
 
@@ -2370,7 +2403,7 @@ void FourTwoStraightItem::paint(QPainter *painter, const QStyleOptionGraphicsIte
     painter->rotate(-90);
 
     const QPixmap * qPixmap = IconLibrary::Instance().findIcon( modelObject()->iddObject().type().value() );
-    painter->drawPixmap(12,12,75,75,*qPixmap);
+    drawComponentIcon(painter,12,12,75,75,*qPixmap);
 
     painter->rotate(90);
     painter->translate(0,-100);
@@ -2481,7 +2514,7 @@ void OneThreeNodeItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *
   setZValue(1);
   painter->drawEllipse(43,43,15,15);
 
-  if(m_modelObject)
+  if(m_modelObject && drawDetail(painter))
   {
     if( model::OptionalNode node = m_modelObject->optionalCast<model::Node>() )
     {
@@ -2724,7 +2757,7 @@ void TwoFourNodeItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *o
   setZValue(1);
   painter->drawEllipse(43,43,15,15);
 
-  if(m_modelObject)
+  if(m_modelObject && drawDetail(painter))
   {
     if( model::OptionalNode node = m_modelObject->optionalCast<model::Node>() )
     {
@@ -2895,7 +2928,7 @@ void OAStraightNodeItem::paint(QPainter *painter, const QStyleOptionGraphicsItem
   setZValue(1);
   painter->drawEllipse(43,43,15,15);
 
-  if(m_modelObject)
+  if(m_modelObject && drawDetail(painter))
   {
     if( model::OptionalNode node = m_modelObject->optionalCast<model::Node>() )
     {
@@ -3034,7 +3067,7 @@ void OAMixerItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *optio
   if( modelObject() )
   {
     const QPixmap * qPixmap = IconLibrary::Instance().findIcon( modelObject()->iddObject().type().value() );
-    painter->drawPixmap(0,0,200,100,*qPixmap);
+    drawComponentIcon(painter,0,0,200,100,*qPixmap);
   }
 }
 
@@ -3116,7 +3149,7 @@ void SplitterItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *opti
     midpointIndex = 0;
     const QPixmap * qPixmap = IconLibrary::Instance().findIcon(
                               modelObject()->iddObject().type().value() );
-    painter->drawPixmap(12,(midpointIndex * 100) + 12,75,75,*qPixmap);
+    drawComponentIcon(painter,12,(midpointIndex * 100) + 12,75,75,*qPixmap);
   }
   else
   {
@@ -3265,7 +3298,7 @@ void SupplySplitterItem::paint(QPainter *painter, const QStyleOptionGraphicsItem
     painter->drawLine(50,m_baselineBranchPositions.front() * 100 + 50,50,m_baselineBranchPositions.back() * 100 + 50);
   } else {
     QPixmap qPixmap(":images/supply_splitter.png");
-    painter->drawPixmap(12,12,75,75,qPixmap);
+    drawComponentIcon(painter,12,12,75,75,qPixmap);
   }
   painter->drawLine(0,(midpointIndex * 100) + 50,50,(midpointIndex * 100) + 50);
 }
@@ -3333,7 +3366,7 @@ void MixerItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *option,
     midpointIndex = 0;
     const QPixmap * qPixmap = IconLibrary::Instance().findIcon(
                               modelObject()->iddObject().type().value() );
-    painter->drawPixmap(12,(midpointIndex * 100) + 12,75,75,*qPixmap);
+    drawComponentIcon(painter,12,(midpointIndex * 100) + 12,75,75,*qPixmap);
   }
   else
   {
@@ -3381,7 +3414,7 @@ void SupplyMixerItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *o
   {
     midpointIndex = 0;
     QPixmap qPixmap(":/images/supply_mixer.png");
-    painter->drawPixmap(12,(midpointIndex * 100) + 12,75,75,qPixmap);
+    drawComponentIcon(painter,12,(midpointIndex * 100) + 12,75,75,qPixmap);
   }
   else
   {
@@ -34,6 +34,9 @@ namespace openstudio {
 GridScene::GridScene( QObject * parent )
   : QGraphicsScene(parent)
 {
+  // Items are laid out once and don't move, so the tree stays valid and painting or hit testing a large loop
+  // only visits the items of the exposed cells
+  setItemIndexMethod(QGraphicsScene::BspTreeIndex);
 }
 
 QRectF GridScene::getCell(int xindex, int yindex)
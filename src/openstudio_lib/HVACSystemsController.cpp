@@ -144,6 +144,9 @@ const QString SHW = "SHW";
 const QString REFRIGERATION = "REFRIGERATION";
 const QString VRF = "VRF";
 
+// switching between this many loops doesn't lay them out again
+const size_t LOOPSCENECACHESIZE = 12;
+
 HVACSystemsController::HVACSystemsController(bool isIP, const model::Model & model)
   : QObject(),
     m_model(model),
@@ -177,17 +180,15 @@ HVACSystemsController::HVACSystemsController(bool isIP, const model::Model & mod
 
 
   // connect initial loops to trigger a refresh of the system combo box
-  auto airloops = m_model.getModelObjects<model::AirLoopHVAC>();
-  std::sort(airloops.begin(),airloops.end(),WorkspaceObjectNameLess());
-  for( auto it = airloops.begin(); it != airloops.end(); ++it ) {
+  m_airLoops = m_model.getModelObjects<model::AirLoopHVAC>();
+  for( auto it = m_airLoops.begin(); it != m_airLoops.end(); ++it ) {
     // Trigger a full refresh if the airLoop name changes
     LOG(LOGLEVEL, "HVACSystemsController Ctor: Attaching name change for AirLoopHVAC " << it->nameString());
     it->getImpl<detail::IdfObject_Impl>().get()->detail::IdfObject_Impl::onNameChange.connect<HVACSystemsController, &HVACSystemsController::repopulateSystemComboBox>(this);
   }
 
-  auto plantloops = m_model.getModelObjects<model::PlantLoop>();
-  std::sort(plantloops.begin(),plantloops.end(),WorkspaceObjectNameLess());
-  for( auto it = plantloops.begin(); it != plantloops.end(); ++it ) {
+  m_plantLoops = m_model.getModelObjects<model::PlantLoop>();
+  for( auto it = m_plantLoops.begin(); it != m_plantLoops.end(); ++it ) {
     LOG(LOGLEVEL, "HVACSystemsController Ctor: Attaching name change for PlantLoop " << it->nameString());
     it->getImpl<detail::IdfObject_Impl>().get()->detail::IdfObject_Impl::onNameChange.connect<HVACSystemsController, &HVACSystemsController::repopulateSystemComboBox>(this);
   }
@@ -248,16 +249,14 @@ void HVACSystemsController::repopulateSystemComboBox() {
   // Repopulate
   systemComboBox->clear();
 
-  // Populate system combo box
-  auto airloops = m_model.getModelObjects<model::AirLoopHVAC>();
-  std::sort(airloops.begin(),airloops.end(),WorkspaceObjectNameLess());
-  for( auto it = airloops.begin(); it != airloops.end(); ++it ) {
+  // Populate system combo box, names may have changed since the last time
+  std::sort(m_airLoops.begin(),m_airLoops.end(),WorkspaceObjectNameLess());
+  for( auto it = m_airLoops.begin(); it != m_airLoops.end(); ++it ) {
     systemComboBox->addItem(QString::fromStdString(it->name().get()), toQString(it->handle()));
   }
 
-  auto plantloops = m_model.getModelObjects<model::PlantLoop>();
-  std::sort(plantloops.begin(),plantloops.end(),WorkspaceObjectNameLess());
-  for( auto it = plantloops.begin(); it != plantloops.end(); ++it ) {
+  std::sort(m_plantLoops.begin(),m_plantLoops.end(),WorkspaceObjectNameLess());
+  for( auto it = m_plantLoops.begin(); it != m_plantLoops.end(); ++it ) {
     systemComboBox->addItem(QString::fromStdString(it->name().get()), toQString(it->handle()));
   }
 
@@ -350,13 +349,15 @@ void HVACSystemsController::update()
     // Show Controls, to avoid still displaying the name of a previously selected "Water Use Connection" object for eg
     m_hvacSystemsView->hvacToolbarView->showControls(true);
 
-    m_hvacLayoutController.reset();
+    // The layout controller and its view are kept while switching between loops, only the scene changes
+    bool showLayout = (handle != REFRIGERATION) && (handle != VRF) && m_hvacSystemsView->hvacToolbarView->topologyViewButton->isChecked();
+    if( !showLayout ) {
+      m_hvacLayoutController.reset();
+    }
     m_hvacControlsController.reset();
     m_refrigerationController.reset();
     m_vrfController.reset();
 
-    OSAppBase::instance()->processEvents();
-
     if( handle == REFRIGERATION )
     {
       m_hvacSystemsView->hvacToolbarView->zoomInButton->setEnabled(false);
@@ -426,7 +427,11 @@ void HVACSystemsController::update()
     {
       if( m_hvacSystemsView->hvacToolbarView->topologyViewButton->isChecked() )
       {
-        m_hvacLayoutController = std::shared_ptr<HVACLayoutController>(new HVACLayoutController(this));
+        if( m_hvacLayoutController ) {
+          m_hvacLayoutController->updateLater();
+        } else {
+          m_hvacLayoutController = std::shared_ptr<HVACLayoutController>(new HVACLayoutController(this));
+        }
         m_hvacSystemsView->mainViewSwitcher->setView(m_hvacLayoutController->hvacGraphicsView());
 
         m_hvacSystemsView->hvacToolbarView->zoomInButton->setEnabled(true);
@@ -528,6 +533,12 @@ void HVACSystemsController::onObjectAdded(const WorkspaceObject& workspaceObject
     updateLater();
   }
 
+  if( newObjectIddType == model::AirLoopHVAC::iddObjectType() ) {
+    m_airLoops.push_back(workspaceObject.cast<model::AirLoopHVAC>());
+  } else if( newObjectIddType == model::PlantLoop::iddObjectType() ) {
+    m_plantLoops.push_back(workspaceObject.cast<model::PlantLoop>());
+  }
+
   // If it's a Loop, we trigger a repopulation of the System Combobox upon name change
   if( (newObjectIddType == model::PlantLoop::iddObjectType() )
       || (newObjectIddType == model::AirLoopHVAC::iddObjectType() ) ) {
@@ -542,6 +553,20 @@ void HVACSystemsController::onObjectRemoved(const WorkspaceObject& workspaceObje
 
   if(std::find(types.begin(),types.end(),workspaceObject.cast<model::ModelObject>().iddObjectType()) != types.end())
   {
+    auto sameHandle = [&uuid](const WorkspaceObject & loop) { return loop.handle() == uuid; };
+    m_airLoops.erase(std::remove_if(m_airLoops.begin(), m_airLoops.end(), sameHandle), m_airLoops.end());
+    m_plantLoops.erase(std::remove_if(m_plantLoops.begin(), m_plantLoops.end(), sameHandle), m_plantLoops.end());
+
+    for( auto it = m_loopScenes.begin(); it != m_loopScenes.end(); ++it ) {
+      if( it->first == uuid ) {
+        if( it->second ) {
+          it->second->deleteLater();
+        }
+        m_loopScenes.erase(it);
+        break;
+      }
+    }
+
     updateLater();
   }
 }
@@ -683,6 +708,32 @@ boost::optional<model::Loop> HVACSystemsController::currentLoop() const
   return m_model.getModelObject<model::Loop>(toUUID(m_currentHandle));
 }
 
+LoopScene * HVACSystemsController::loopScene(const model::Loop & loop)
+{
+  for( auto it = m_loopScenes.begin(); it != m_loopScenes.end(); ++it ) {
+    if( it->first == loop.handle() ) {
+      if( it->second ) {
+        m_loopScenes.splice(m_loopScenes.begin(), m_loopScenes, it);
+        return m_loopScenes.front().second;
+      }
+      m_loopScenes.erase(it);
+      break;
+    }
+  }
+
+  auto scene = new LoopScene(loop, this);
+  m_loopScenes.push_front(std::make_pair(loop.handle(), QPointer<LoopScene>(scene)));
+
+  while( m_loopScenes.size() > LOOPSCENECACHESIZE ) {
+    if( m_loopScenes.back().second ) {
+      m_loopScenes.back().second->deleteLater();
+    }
+    m_loopScenes.pop_back();
+  }
+
+  return scene;
+}
+
 void HVACLayoutController::removeModelObject(model::ModelObject & modelObject)
 {
   if( modelObject.handle().isNull() ) return;
@@ -1766,10 +1817,13 @@ void HVACLayoutController::update()
   {
     model::Model t_model = m_hvacSystemsController->model();
 
-    // Remove old stuff
+    // Remove old stuff, loop scenes are kept by the systems controller
     if( QGraphicsScene * oldScene = m_hvacGraphicsView->scene() )
     {
-      oldScene->deleteLater();
+      if( !qobject_cast<LoopScene *>(oldScene) )
+      {
+        oldScene->deleteLater();
+      }
     }
 
     QString handle = m_hvacSystemsController->currentHandle();
@@ -1782,18 +1836,19 @@ void HVACLayoutController::update()
       {
         m_hvacSystemsController->hvacSystemsView()->hvacToolbarView->showControls(true);
 
-        LoopScene * loopScene = new LoopScene(loop.get());
+        LoopScene * loopScene = m_hvacSystemsController->loopScene(loop.get());
 
         m_hvacGraphicsView->setScene(loopScene);
 
 
-        connect(loopScene, &LoopScene::modelObjectSelected, this, &HVACLayoutController::onModelObjectSelected);
+        // a cached scene may have been shown by this controller before
+        connect(loopScene, &LoopScene::modelObjectSelected, this, &HVACLayoutController::onModelObjectSelected, Qt::UniqueConnection);
 
-        connect(loopScene, &LoopScene::removeModelObjectClicked, this, &HVACLayoutController::removeModelObject);
+        connect(loopScene, &LoopScene::removeModelObjectClicked, this, &HVACLayoutController::removeModelObject, Qt::UniqueConnection);
 
-        connect(loopScene, &LoopScene::innerNodeClicked, this, &HVACLayoutController::goToOtherLoop);
+        connect(loopScene, &LoopScene::innerNodeClicked, this, &HVACLayoutController::goToOtherLoop, Qt::UniqueConnection);
 
-        connect(loopScene, static_cast<void (LoopScene::*)(OSItemId, model::HVACComponent &)>(&LoopScene::hvacComponentDropped), this, &HVACLayoutController::addLibraryObjectToModelNode);
+        connect(loopScene, static_cast<void (LoopScene::*)(OSItemId, model::HVACComponent &)>(&LoopScene::hvacComponentDropped), this, &HVACLayoutController::addLibraryObjectToModelNode, Qt::UniqueConnection);
       }
       else if( boost::optional<model::WaterUseConnections> waterUseConnections = mo->optionalCast<model::WaterUseConnections>() )
       {
@@ -33,6 +33,8 @@
 #include <openstudio/model/Model.hpp>
 #include <openstudio/model/ModelObject.hpp>
 #include <openstudio/model/Loop.hpp>
+#include <openstudio/model/AirLoopHVAC.hpp>
+#include <openstudio/model/PlantLoop.hpp>
 #include "OSDropZone.hpp"
 #include "ModelObjectItem.hpp"
 #include "ModelObjectVectorController.hpp"
@@ -46,6 +48,8 @@
 #include <openstudio/nano/nano_signal_slot.hpp> // Signal-Slot replacement
 #include "../model_editor/QMetaTypes.hpp"
 
+#include <list>
+
 class QMutex;
 
 namespace openstudio {
@@ -61,6 +65,7 @@ class AvailabilityManagerAssignmentList;
 }
 
 class LoopView;
+class LoopScene;
 class HVACSystemsView;
 class HVACAirLoopControlsView;
 class HVACPlantLoopControlsView;
@@ -116,6 +121,10 @@ class HVACSystemsController : public QObject, public Nano::Observer
 
   void clearSceneSelection();
 
+  // The scene of the loop, laid out again only if it is not one of the scenes shown last.
+  // The scenes keep themselves up to date with the model and are owned by this controller.
+  LoopScene * loopScene(const model::Loop & loop);
+
   public slots:
 
   void updateLater();
@@ -160,6 +169,14 @@ class HVACSystemsController : public QObject, public Nano::Observer
 
   std::vector<IddObjectType> systemComboBoxTypes() const;
 
+  // The loops of the system combo box, maintained as loops are added and removed rather than queried from the model
+  std::vector<model::AirLoopHVAC> m_airLoops;
+
+  std::vector<model::PlantLoop> m_plantLoops;
+
+  // Most recently shown first
+  std::list<std::pair<Handle, QPointer<LoopScene> > > m_loopScenes;
+
   QPointer<HVACSystemsView> m_hvacSystemsView;
 
   std::shared_ptr<HVACLayoutController> m_hvacLayoutController;
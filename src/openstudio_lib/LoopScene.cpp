@@ -37,6 +37,7 @@
 #include <QGraphicsItem>
 #include <QMimeData>
 #include <cmath>
+#include <openstudio/model/AirLoopHVAC.hpp>
 #include <openstudio/model/Loop.hpp>
 #include <openstudio/model/Model.hpp>
 #include <openstudio/model/Model_Impl.hpp>
@@ -53,6 +54,7 @@
 #include <openstudio/model/ThermalZone_Impl.hpp>
 #include <openstudio/model/Node.hpp>
 #include <openstudio/model/Node_Impl.hpp>
+#include <openstudio/model/PlantLoop.hpp>
 #include <QTimer>
 
 using namespace openstudio::model;
@@ -63,8 +65,14 @@ LoopScene::LoopScene( model::Loop loop,
                       QObject * parent )
   : GridScene(parent),
     m_loop(loop),
-    m_dirty(true)
+    m_dirty(true),
+    m_layoutTimer(new QTimer(this))
 {
+  // a measure or a paste adds many objects at once, they all end up in a single layout
+  m_layoutTimer->setSingleShot(true);
+  m_layoutTimer->setInterval(0);
+  connect(m_layoutTimer, &QTimer::timeout, this, &LoopScene::layout);
+
   // loop.model().getImpl<model::detail::Model_Impl>().get()->addWorkspaceObjectPtr.connect<LoopScene, &LoopScene::addedWorkspaceObject>(this);
   connect(OSAppBase::instance(), &OSAppBase::workspaceObjectAddedPtr, this, &LoopScene::addedWorkspaceObject, Qt::QueuedConnection);
 
@@ -97,12 +105,62 @@ void LoopScene::layout()
 
     this->setSceneRect(0,0,(systemItem->getHGridLength() * 100) + 100, ((systemItem->getVGridLength()) * 100) + 100);
 
+    m_handles.clear();
+    m_handles.insert(m_loop.handle());
+    for( QGraphicsItem * item : items() )
+    {
+      if( auto modelObjectItem = dynamic_cast<ModelObjectGraphicsItem *>(item) )
+      {
+        if( auto modelObject = modelObjectItem->modelObject() )
+        {
+          m_handles.insert(modelObject->handle());
+        }
+      }
+    }
+
     update();
 
     m_dirty = false;
   }
 }
 
+void LoopScene::scheduleLayout()
+{
+  m_dirty = true;
+
+  m_layoutTimer->start();
+}
+
+bool LoopScene::isOnLoop(const model::HVACComponent & component) const
+{
+  const Handle handle = m_loop.handle();
+
+  if( auto loop = component.loop() )
+  {
+    if( loop->handle() == handle ) { return true; }
+  }
+
+  if( auto airLoop = component.airLoopHVAC() )
+  {
+    if( airLoop->handle() == handle ) { return true; }
+  }
+
+  if( auto plantLoop = component.plantLoop() )
+  {
+    if( plantLoop->handle() == handle ) { return true; }
+  }
+
+  if( auto oaSystem = component.airLoopHVACOutdoorAirSystem() )
+  {
+    if( auto airLoop = oaSystem->airLoopHVAC() )
+    {
+      if( airLoop->handle() == handle ) { return true; }
+    }
+  }
+
+  return false;
+}
+
 DemandSideItem * LoopScene::createDemandSide()
 {
   auto demandInletNodes = m_loop.demandInletNodes();
@@ -134,20 +192,31 @@ model::Loop LoopScene::loop()
 
 void LoopScene::addedWorkspaceObject(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> wPtr, const openstudio::IddObjectType& type, const openstudio::UUID& uuid )
 {
+  if( m_loop.handle().isNull() )
+  {
+    return;
+  }
+
   model::detail::HVACComponent_Impl* hvac_impl = dynamic_cast<model::detail::HVACComponent_Impl*>(wPtr.get());
   if(hvac_impl)
   {
-    m_dirty = true;
-
-    QTimer::singleShot(0,this,SLOT(layout()));
+    // the connection is queued, the object may be gone already
+    if( auto component = m_loop.model().getModelObject<model::HVACComponent>(uuid) )
+    {
+      if( isOnLoop(component.get()) )
+      {
+        scheduleLayout();
+      }
+    }
   }
 }
 
 void LoopScene::removedWorkspaceObject(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> wPtr, const openstudio::IddObjectType& type, const openstudio::UUID& uuid )
 {
-  m_dirty = true;
-
-  QTimer::singleShot(0,this,SLOT(layout()));
+  if( m_handles.find(uuid) != m_handles.end() )
+  {
+    scheduleLayout();
+  }
 }
 
 } // openstudio
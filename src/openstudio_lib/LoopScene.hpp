@@ -38,6 +38,10 @@
 #include "GridScene.hpp"
 #include "../model_editor/QMetaTypes.hpp"
 
+#include <set>
+
+class QTimer;
+
 namespace openstudio {
 
 namespace model {
@@ -86,6 +90,9 @@ class LoopScene : public GridScene
 
   void layout();
 
+  // marks the scene dirty and lays it out once the pending model changes have been processed
+  void scheduleLayout();
+
   //signals:
   //
   //void modelObjectSelected( model::OptionalModelObject &, bool readOnly );
@@ -104,9 +111,17 @@ class LoopScene : public GridScene
 
   void initDefault();
 
+  // true if the component is drawn on this loop, directly or in its outdoor air system
+  bool isOnLoop(const model::HVACComponent & component) const;
+
   model::Loop m_loop;
 
   bool m_dirty;
+
+  // handles of the model objects drawn in the scene, removing any other object leaves the layout as is
+  std::set<Handle> m_handles;
+
+  QTimer * m_layoutTimer;
 };
 
 } // openstudio
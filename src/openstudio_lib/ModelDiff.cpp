@@ -0,0 +1,253 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "ModelDiff.hpp"
+
+#include <openstudio/utilities/idd/IddEnums.hpp>
+#include <openstudio/utilities/idd/IddField.hpp>
+#include <openstudio/utilities/idd/IddFieldProperties.hpp>
+#include <openstudio/utilities/idd/IddObject.hpp>
+#include <openstudio/utilities/idf/IdfExtensibleGroup.hpp>
+#include <openstudio/utilities/idf/IdfObject.hpp>
+#include <openstudio/utilities/idf/WorkspaceObject.hpp>
+#include <openstudio/utilities/core/Assert.hpp>
+
+namespace openstudio {
+
+static bool isObjectListField(const IddObject& iddObject, unsigned index)
+{
+  // getField handles indices into extensible groups
+  boost::optional<IddField> iddField = iddObject.getField(index);
+  return (iddField && (iddField->properties().type == IddFieldType::ObjectListType));
+}
+
+ModelDiff::ModelDiff(const model::Model& currentModel, const model::Model& newModel)
+  : m_currentModel(currentModel),
+    m_newModel(newModel)
+{
+  for (const auto& newObject : m_newModel.objects()){
+    boost::optional<WorkspaceObject> currentObject = m_currentModel.getObject(newObject.handle());
+    if (!currentObject){
+      m_addedObjects.push_back(newObject.handle());
+    } else if (currentObject->iddObject().type() != newObject.iddObject().type()){
+      // same handle but a different type, should not happen but treat as replaced
+      m_removedObjects.push_back(currentObject->handle());
+      m_addedObjects.push_back(newObject.handle());
+    } else if (!objectsEqual(*currentObject, newObject)){
+      m_changedObjects.push_back(newObject.handle());
+    }
+  }
+
+  for (const auto& currentObject : m_currentModel.objects()){
+    if (!m_newModel.getObject(currentObject.handle())){
+      m_removedObjects.push_back(currentObject.handle());
+    }
+  }
+}
+
+const std::vector<Handle>& ModelDiff::addedObjects() const
+{
+  return m_addedObjects;
+}
+
+const std::vector<Handle>& ModelDiff::removedObjects() const
+{
+  return m_removedObjects;
+}
+
+const std::vector<Handle>& ModelDiff::changedObjects() const
+{
+  return m_changedObjects;
+}
+
+bool ModelDiff::empty() const
+{
+  return (m_addedObjects.empty() && m_removedObjects.empty() && m_changedObjects.empty());
+}
+
+bool ModelDiff::objectsEqual(const WorkspaceObject& currentObject, const WorkspaceObject& newObject)
+{
+  if (currentObject.numFields() != newObject.numFields()){
+    return false;
+  }
+
+  IddObject iddObject = newObject.iddObject();
+
+  for (unsigned i = 0; i < newObject.numFields(); ++i){
+    if (isObjectListField(iddObject, i)){
+      // getString returns the name of the target, a renamed or replaced target is only told apart by its handle
+      boost::optional<WorkspaceObject> currentTarget = currentObject.getTarget(i);
+      boost::optional<WorkspaceObject> newTarget = newObject.getTarget(i);
+      if (currentTarget.is_initialized() != newTarget.is_initialized()){
+        return false;
+      }
+      if (newTarget && (currentTarget->handle() != newTarget->handle())){
+        return false;
+      }
+      if (!newTarget && (currentObject.getString(i, false, true) != newObject.getString(i, false, true))){
+        return false;
+      }
+    } else if (currentObject.getString(i, false, true) != newObject.getString(i, false, true)){
+      return false;
+    }
+  }
+
+  return true;
+}
+
+Handle ModelDiff::mapHandle(const Handle& newHandle) const
+{
+  auto it = m_handleMap.find(newHandle);
+  if (it != m_handleMap.end()){
+    return it->second;
+  }
+  return newHandle;
+}
+
+bool ModelDiff::copyFields(const WorkspaceObject& newObject, WorkspaceObject& currentObject, bool pointersOnly)
+{
+  bool result = true;
+
+  // groups that remain keep their values and pointers, only those that differ are set below
+  if (!pointersOnly){
+    while (currentObject.numExtensibleGroups() > newObject.numExtensibleGroups()){
+      if (currentObject.popExtensibleGroup().empty()){
+        LOG(Warn, "Could not remove extensible group of " << currentObject.briefDescription());
+        result = false;
+        break;
+      }
+    }
+    while (currentObject.numExtensibleGroups() < newObject.numExtensibleGroups()){
+      if (currentObject.pushExtensibleGroup().empty()){
+        LOG(Warn, "Could not add extensible group to " << currentObject.briefDescription());
+        result = false;
+        break;
+      }
+    }
+  }
+
+  IddObject iddObject = newObject.iddObject();
+  unsigned begin = iddObject.hasHandleField() ? 1 : 0;
+
+  for (unsigned i = begin; i < newObject.numFields(); ++i){
+
+    if (isObjectListField(iddObject, i)){
+      boost::optional<WorkspaceObject> newTarget = newObject.getTarget(i);
+      boost::optional<WorkspaceObject> currentTarget = currentObject.getTarget(i);
+      if (newTarget){
+        Handle targetHandle = mapHandle(newTarget->handle());
+        if (!currentTarget || (currentTarget->handle() != targetHandle)){
+          if (!currentObject.setPointer(i, targetHandle)){
+            LOG(Warn, "Could not set pointer field " << i << " of " << currentObject.briefDescription());
+            result = false;
+          }
+        }
+      } else if (currentTarget){
+        currentObject.setString(i, "");
+      }
+    } else if (!pointersOnly){
+      boost::optional<std::string> newValue = newObject.getString(i, false, true);
+      if (currentObject.getString(i, false, true) != newValue){
+        if (!currentObject.setString(i, newValue ? *newValue : std::string())){
+          LOG(Warn, "Could not set field " << i << " of " << currentObject.briefDescription());
+          result = false;
+        }
+      }
+    }
+  }
+
+  // optional trailing fields the new object left off
+  if (!pointersOnly){
+    for (unsigned i = newObject.numFields(); i < currentObject.numFields(); ++i){
+      if (currentObject.getString(i, false, true) && !currentObject.setString(i, "")){
+        LOG(Warn, "Could not clear field " << i << " of " << currentObject.briefDescription());
+        result = false;
+      }
+    }
+  }
+
+  return result;
+}
+
+bool ModelDiff::apply()
+{
+  bool result = true;
+
+  m_handleMap.clear();
+
+  // remove first so names of added objects are free
+  if (!m_removedObjects.empty()){
+    if (!m_currentModel.removeObjects(m_removedObjects)){
+      LOG(Error, "Failed to remove " << m_removedObjects.size() << " objects from the model");
+      result = false;
+    }
+  }
+
+  if (!m_addedObjects.empty()){
+    std::vector<IdfObject> idfObjects;
+    for (const auto& handle : m_addedObjects){
+      boost::optional<WorkspaceObject> newObject = m_newModel.getObject(handle);
+      OS_ASSERT(newObject);
+      idfObjects.push_back(newObject->idfObject());
+    }
+
+    // pointers among the added objects are preserved, objects may be given new handles
+    std::vector<WorkspaceObject> addedObjects = m_currentModel.addObjects(idfObjects, false);
+    if (addedObjects.size() == m_addedObjects.size()){
+      for (unsigned i = 0; i < addedObjects.size(); ++i){
+        m_handleMap[m_addedObjects[i]] = addedObjects[i].handle();
+      }
+    } else {
+      LOG(Error, "Failed to add " << m_addedObjects.size() << " objects to the model");
+      result = false;
+    }
+  }
+
+  for (const auto& handle : m_changedObjects){
+    boost::optional<WorkspaceObject> newObject = m_newModel.getObject(handle);
+    boost::optional<WorkspaceObject> currentObject = m_currentModel.getObject(handle);
+    OS_ASSERT(newObject);
+    OS_ASSERT(currentObject);
+    result = copyFields(*newObject, *currentObject, false) && result;
+  }
+
+  // pointers from added objects to existing objects were not part of the batch, make sure they are hooked up
+  for (const auto& handlePair : m_handleMap){
+    boost::optional<WorkspaceObject> newObject = m_newModel.getObject(handlePair.first);
+    boost::optional<WorkspaceObject> currentObject = m_currentModel.getObject(handlePair.second);
+    OS_ASSERT(newObject);
+    if (currentObject){
+      result = copyFields(*newObject, *currentObject, true) && result;
+    }
+  }
+
+  return result;
+}
+
+} // openstudio
@@ -0,0 +1,97 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef OPENSTUDIO_MODELDIFF_HPP
+#define OPENSTUDIO_MODELDIFF_HPP
+
+#include <openstudio/model/Model.hpp>
+
+#include <openstudio/utilities/core/Logger.hpp>
+
+#include <map>
+#include <vector>
+
+namespace openstudio {
+
+class WorkspaceObject;
+
+// Object level difference between two versions of the same model, objects are matched by handle.
+// Used to bring the result of a measure run back into the live model without reloading the document.
+class ModelDiff
+{
+ public:
+
+  // computes the difference needed to turn currentModel into newModel
+  ModelDiff(const model::Model& currentModel, const model::Model& newModel);
+
+  virtual ~ModelDiff() {}
+
+  // handles of objects in newModel which are not in currentModel
+  const std::vector<Handle>& addedObjects() const;
+
+  // handles of objects in currentModel which are not in newModel
+  const std::vector<Handle>& removedObjects() const;
+
+  // handles of objects in both models whose fields differ
+  const std::vector<Handle>& changedObjects() const;
+
+  bool empty() const;
+
+  // applies the difference to currentModel, removals and additions are each done in a single batch
+  // returns false if any object could not be fully applied, currentModel may then be partially updated
+  bool apply();
+
+ private:
+
+  REGISTER_LOGGER("openstudio::ModelDiff");
+
+  static bool objectsEqual(const WorkspaceObject& currentObject, const WorkspaceObject& newObject);
+
+  // copies fields of newObject to currentObject, pointers are redirected using m_handleMap
+  bool copyFields(const WorkspaceObject& newObject, WorkspaceObject& currentObject, bool pointersOnly);
+
+  Handle mapHandle(const Handle& newHandle) const;
+
+  model::Model m_currentModel;
+
+  model::Model m_newModel;
+
+  std::vector<Handle> m_addedObjects;
+
+  std::vector<Handle> m_removedObjects;
+
+  std::vector<Handle> m_changedObjects;
+
+  // handle in newModel to handle in currentModel for added objects
+  std::map<Handle, Handle> m_handleMap;
+};
+
+} // openstudio
+
+#endif // OPENSTUDIO_MODELDIFF_HPP
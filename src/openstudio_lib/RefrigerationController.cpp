@@ -63,10 +63,13 @@
 #include <openstudio/utilities/core/Compare.hpp>
 
 #include "../shared_gui_components/GraphicsItems.hpp"
+#include <QEvent>
 #include <QGraphicsScene>
 #include <QGraphicsView>
+#include <QScrollBar>
 #include <QTimer>
 #include <QMessageBox>
+#include <algorithm>
 
 namespace openstudio {
 
@@ -220,6 +223,8 @@ RefrigerationController::RefrigerationController()
   m_refrigerationSystemGridView = new GridLayoutItem();
   m_refrigerationSystemGridView->setCellSize(RefrigerationSystemMiniView::cellSize());
   m_refrigerationSystemGridView->setMargin(RefrigerationSystemView::margin);
+  // Supermarkets have dozens of racks, mini views are made as they are scrolled into sight
+  m_refrigerationSystemGridView->setVirtualized(true);
 
   m_refrigerationSystemListController = QSharedPointer<RefrigerationSystemListController>(new RefrigerationSystemListController(this));
   m_refrigerationSystemGridView->setListController(m_refrigerationSystemListController);
@@ -230,6 +235,11 @@ RefrigerationController::RefrigerationController()
 
   m_noRefrigerationView = new NoRefrigerationView();
 
+  QGraphicsView * graphicsView = m_refrigerationView->graphicsView;
+  graphicsView->viewport()->installEventFilter(this);
+  connect(graphicsView->verticalScrollBar(), &QScrollBar::valueChanged, this, &RefrigerationController::updateVisibleSystems);
+  connect(graphicsView->horizontalScrollBar(), &QScrollBar::valueChanged, this, &RefrigerationController::updateVisibleSystems);
+
   zoomOutToSystemGridView();
 }
 
@@ -243,6 +253,59 @@ RefrigerationController::~RefrigerationController()
 
 }
 
+bool RefrigerationController::eventFilter(QObject * watched, QEvent * event)
+{
+  if( (event->type() == QEvent::Resize) && m_refrigerationView && (watched == m_refrigerationView->graphicsView->viewport()) )
+  {
+    updateVisibleSystems();
+  }
+
+  return QObject::eventFilter(watched, event);
+}
+
+void RefrigerationController::updateVisibleSystems()
+{
+  if( ! m_refrigerationView || ! m_refrigerationSystemGridView )
+  {
+    return;
+  }
+
+  QGraphicsView * graphicsView = m_refrigerationView->graphicsView;
+
+  if( graphicsView->scene() == m_refrigerationGridScene.data() )
+  {
+    m_refrigerationSystemGridView->setVisibleRect(graphicsView->mapToScene(graphicsView->viewport()->rect()).boundingRect());
+  }
+}
+
+std::vector<model::RefrigerationSystem> RefrigerationController::linkedSystems(const model::RefrigerationSystem & system)
+{
+  std::vector<model::RefrigerationSystem> result;
+
+  result.push_back(system);
+
+  for( const auto & cascadeCondenser : system.cascadeCondenserLoads() )
+  {
+    if( boost::optional<model::RefrigerationSystem> t_cascadeSystem = cascadeSystem(cascadeCondenser) )
+    {
+      result.push_back(t_cascadeSystem.get());
+    }
+  }
+
+  if( boost::optional<model::ModelObject> condenser = system.refrigerationCondenser() )
+  {
+    if( boost::optional<model::RefrigerationCondenserCascade> cascadeCondenser = condenser->optionalCast<model::RefrigerationCondenserCascade>() )
+    {
+      if( boost::optional<model::RefrigerationSystem> t_supplySystem = supplySystem(cascadeCondenser.get()) )
+      {
+        result.push_back(t_supplySystem.get());
+      }
+    }
+  }
+
+  return result;
+}
+
 boost::optional<model::RefrigerationSystem> RefrigerationController::supplySystem(const model::RefrigerationCondenserCascade & condenser)
 {
   boost::optional<model::RefrigerationSystem> result;
@@ -308,6 +371,12 @@ void RefrigerationController::zoomInOnSystem(model::RefrigerationSystem & refrig
 
   m_currentSystem = refrigerationSystem;
 
+  // Links removed while zoomed in still need their mini views refreshed
+  for( const auto & system : linkedSystems(refrigerationSystem) )
+  {
+    m_editedSystems.insert(system.handle());
+  }
+
   if( m_refrigerationScene )
   {
     m_refrigerationScene->deleteLater();
@@ -362,17 +431,33 @@ void RefrigerationController::zoomOutToSystemGridView()
 
   doc->mainRightColumnController()->inspectModelObject(mo,false);
 
+  // Changes not refreshed yet, unless the system is gone
+  if( m_currentSystem )
+  {
+    if( boost::optional<model::RefrigerationSystem> system = doc->model().getModelObject<model::RefrigerationSystem>(m_currentSystem->handle()) )
+    {
+      for( const auto & linkedSystem : linkedSystems(system.get()) )
+      {
+        m_editedSystems.insert(linkedSystem.handle());
+      }
+    }
+  }
+
   m_currentSystem = boost::none;
 
   m_refrigerationView->header->hide();
 
-  m_refrigerationSystemListController->reset();
+  // Systems added or removed are inserted or removed as they happen, only the ones that were edited need a new mini view
+  m_refrigerationSystemListController->refreshSystems(m_editedSystems);
+  m_editedSystems.clear();
 
   refresh();
 
   m_refrigerationView->graphicsView->setScene(m_refrigerationGridScene.data());
 
   m_refrigerationView->graphicsView->setAlignment(Qt::AlignLeft | Qt::AlignTop);
+
+  updateVisibleSystems();
 }
 
 void RefrigerationController::onCondenserViewDrop(const OSItemId & itemid)
@@ -703,6 +788,14 @@ void RefrigerationController::refreshNow()
     refreshRefrigerationSystemView(m_detailView,m_currentSystem);
   }
 
+  if( m_currentSystem )
+  {
+    for( const auto & system : linkedSystems(m_currentSystem.get()) )
+    {
+      m_editedSystems.insert(system.handle());
+    }
+  }
+
   m_dirty = false;
 }
 
@@ -781,15 +874,44 @@ RefrigerationSystemListController::RefrigerationSystemListController(Refrigerati
   std::shared_ptr<OSDocument> doc = OSAppBase::instance()->currentDocument();
   model::Model t_model = doc->model();
   t_model.getImpl<model::detail::Model_Impl>().get()->addWorkspaceObject.connect<RefrigerationSystemListController, &RefrigerationSystemListController::onModelObjectAdd>(this);
+  t_model.getImpl<model::detail::Model_Impl>().get()->removeWorkspaceObject.connect<RefrigerationSystemListController, &RefrigerationSystemListController::onModelObjectRemove>(this);
 
   connect(this, &RefrigerationSystemListController::itemInsertedPrivate, this, &RefrigerationSystemListController::itemInserted, Qt::QueuedConnection);
 }
 
 void RefrigerationSystemListController::reset()
 {
+  m_systems = boost::none;
+
   emit modelReset();
 }
 
+void RefrigerationSystemListController::refreshSystems(const std::set<Handle> & handles)
+{
+  if( handles.empty() )
+  {
+    return;
+  }
+
+  std::vector<model::RefrigerationSystem> _systems = systems();
+
+  // An edited system may have been renamed, the cached order is stale then and the whole grid is rebuilt
+  if( ! std::is_sorted(_systems.begin(), _systems.end(), WorkspaceObjectNameLess()) )
+  {
+    reset();
+
+    return;
+  }
+
+  for( size_t i = 0; i < _systems.size(); ++i )
+  {
+    if( handles.count(_systems[i].handle()) )
+    {
+      emit itemChanged(static_cast<int>(i) + 1);
+    }
+  }
+}
+
 RefrigerationController * RefrigerationSystemListController::refrigerationController() const
 {
   return m_refrigerationController;
@@ -849,10 +971,20 @@ void RefrigerationSystemListController::onModelObjectAdd(const WorkspaceObject&
 {
   if( iddObjectType == model::RefrigerationSystem::iddObjectType() )
   {
+    m_systems = boost::none;
+
     emit itemInsertedPrivate(systemIndex(object.cast<model::RefrigerationSystem>()));
   }
 }
 
+void RefrigerationSystemListController::onModelObjectRemove(const WorkspaceObject& object, const openstudio::IddObjectType& iddObjectType, const openstudio::UUID& handle)
+{
+  if( iddObjectType == model::RefrigerationSystem::iddObjectType() )
+  {
+    m_systems = boost::none;
+  }
+}
+
 void RefrigerationSystemListController::addSystem(const OSItemId & itemid)
 {
   std::shared_ptr<OSDocument> doc = OSAppBase::instance()->currentDocument();
@@ -885,16 +1017,21 @@ void RefrigerationSystemListController::removeSystem(model::RefrigerationSystem
 
 std::vector<model::RefrigerationSystem> RefrigerationSystemListController::systems() const
 {
-  std::vector<model::RefrigerationSystem> result;
-
-  if( boost::optional<model::Model> model = OSAppBase::instance()->currentModel() )
+  if( ! m_systems )
   {
-    result = model->getConcreteModelObjects<model::RefrigerationSystem>();
-  }
+    std::vector<model::RefrigerationSystem> result;
+
+    if( boost::optional<model::Model> model = OSAppBase::instance()->currentModel() )
+    {
+      result = model->getConcreteModelObjects<model::RefrigerationSystem>();
+    }
 
-  std::sort(result.begin(), result.end(), WorkspaceObjectNameLess());
+    std::sort(result.begin(), result.end(), WorkspaceObjectNameLess());
 
-  return result;
+    m_systems = result;
+  }
+
+  return m_systems.get();
 }
 
 RefrigerationSystemListItem::RefrigerationSystemListItem(const model::RefrigerationSystem & refrigerationSystem,OSListController * listController)
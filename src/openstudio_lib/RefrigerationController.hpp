@@ -36,6 +36,8 @@
 #include "../model_editor/QMetaTypes.hpp"
 #include <openstudio/model/RefrigerationSystem.hpp>
 
+#include <set>
+
 class QGraphicsScene;
 class QGraphicsView;
 class QGraphicsObject;
@@ -76,6 +78,10 @@ class RefrigerationController : public QObject
 
   void refreshRefrigerationSystemView(RefrigerationSystemView * systemView, boost::optional<model::RefrigerationSystem> & system);
 
+  protected:
+
+  bool eventFilter(QObject * watched, QEvent * event) override;
+
   public slots:
 
   void zoomInOnSystem(const Handle & handle);
@@ -90,6 +96,9 @@ class RefrigerationController : public QObject
 
   void refreshNow();
 
+  // Tells the system grid which of its cells are in sight so that only those get a mini view
+  void updateVisibleSystems();
+
   void onCondenserViewDrop(const OSItemId & itemid);
 
   void onCompressorViewDrop(const OSItemId & itemid);
@@ -118,6 +127,9 @@ class RefrigerationController : public QObject
 
   private:
 
+  // The system and those connected to it through cascade condensers, their mini views show each other
+  static std::vector<model::RefrigerationSystem> linkedSystems(const model::RefrigerationSystem & system);
+
   QPointer<RefrigerationView> m_refrigerationView;
 
   QPointer<GridLayoutItem> m_refrigerationSystemGridView;
@@ -135,6 +147,9 @@ class RefrigerationController : public QObject
   bool m_dirty;
 
   boost::optional<model::RefrigerationSystem> m_currentSystem;
+
+  // Systems changed while zoomed in, their mini views are refreshed when zooming out
+  std::set<Handle> m_editedSystems;
 };
 
 class RefrigerationSystemListController : public OSListController
@@ -151,6 +166,9 @@ class RefrigerationSystemListController : public OSListController
 
   void reset();
 
+  // Refreshes the mini views of the systems only, or the whole grid if a rename changed their order
+  void refreshSystems(const std::set<Handle> & handles);
+
   signals:
 
   void itemInsertedPrivate(int i);
@@ -165,11 +183,16 @@ class RefrigerationSystemListController : public OSListController
 
   void onModelObjectAdd(const WorkspaceObject& object, const openstudio::IddObjectType& iddObjectType, const openstudio::UUID& handle);
 
+  void onModelObjectRemove(const WorkspaceObject& object, const openstudio::IddObjectType& iddObjectType, const openstudio::UUID& handle);
+
   private:
 
   std::vector<model::RefrigerationSystem> systems() const;
   int systemIndex(const model::RefrigerationSystem & system) const;
   QPointer<RefrigerationController> m_refrigerationController;
+
+  // Sorted systems, itemAt and count are called for every cell of the grid
+  mutable boost::optional<std::vector<model::RefrigerationSystem> > m_systems;
 };
 
 // A delegate to provide cells of the refrigeration system grid
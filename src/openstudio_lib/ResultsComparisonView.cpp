@@ -0,0 +1,392 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "ResultsComparisonView.hpp"
+
+#include "../model_editor/Utilities.hpp"
+
+#include <QBoxLayout>
+#include <QHeaderView>
+#include <QLabel>
+#include <QListWidget>
+#include <QTableWidget>
+#include <QtConcurrent>
+
+#include <algorithm>
+#include <cmath>
+#include <set>
+
+namespace openstudio {
+
+namespace {
+
+  // one line of the comparison with the value of each run, in the order of the columns
+  struct ComparisonRow
+  {
+    QString label;
+    std::string units;
+    std::vector<boost::optional<double>> values;
+    bool section;
+  };
+
+  // rows of a section are matched by label, returns the index of the first row of the section
+  size_t addSection(std::vector<ComparisonRow>& rows, const QString& title, size_t runs)
+  {
+    rows.push_back(ComparisonRow{title, std::string(), std::vector<boost::optional<double>>(runs), true});
+    return rows.size();
+  }
+
+  void addValue(std::vector<ComparisonRow>& rows, size_t sectionStart, const QString& label, const std::string& units, size_t run, double value)
+  {
+    for (size_t i = sectionStart; i < rows.size(); ++i){
+      if (rows[i].label == label){
+        rows[i].values[run] = value;
+        return;
+      }
+    }
+
+    ComparisonRow row{label, units, std::vector<boost::optional<double>>(rows[sectionStart - 1].values.size()), false};
+    row.values[run] = value;
+    rows.push_back(row);
+  }
+
+  // aligns the tables of the runs, end uses and zones missing from a run are left empty
+  std::vector<ComparisonRow> comparisonRows(const std::vector<boost::optional<ResultsSummary>>& summaries)
+  {
+    std::vector<ComparisonRow> rows;
+    size_t n = summaries.size();
+
+    size_t start = addSection(rows, "Site Energy", n);
+    for (size_t run = 0; run < n; ++run){
+      if (summaries[run] && summaries[run]->netSiteEnergy){
+        addValue(rows, start, "Net Site Energy", summaries[run]->netSiteEnergyUnits, run, *summaries[run]->netSiteEnergy);
+      }
+    }
+
+    start = addSection(rows, "End Uses", n);
+    for (size_t run = 0; run < n; ++run){
+      if (!summaries[run]){
+        continue;
+      }
+      const ResultsSummary& summary = *summaries[run];
+      for (const auto& endUse : summary.endUses){
+        for (size_t j = 0; j < summary.fuels.size(); ++j){
+          addValue(rows, start, QString::fromStdString(endUse.first + ": " + summary.fuels[j]), summary.fuelUnits[j], run, endUse.second[j]);
+        }
+      }
+    }
+
+    start = addSection(rows, "Peak Demand", n);
+    for (size_t run = 0; run < n; ++run){
+      if (!summaries[run]){
+        continue;
+      }
+      const ResultsSummary& summary = *summaries[run];
+      for (size_t j = 0; j < summary.fuels.size(); ++j){
+        addValue(rows, start, QString::fromStdString(summary.fuels[j]), summary.peakDemandUnits[j], run, summary.peakDemands[j]);
+      }
+    }
+
+    start = addSection(rows, "Unmet Hours", n);
+    for (size_t run = 0; run < n; ++run){
+      if (summaries[run] && summaries[run]->hoursHeatingNotMet){
+        addValue(rows, start, "Occupied Heating", "hr", run, *summaries[run]->hoursHeatingNotMet);
+      }
+      if (summaries[run] && summaries[run]->hoursCoolingNotMet){
+        addValue(rows, start, "Occupied Cooling", "hr", run, *summaries[run]->hoursCoolingNotMet);
+      }
+    }
+
+    start = addSection(rows, "Zone Sensible Cooling Design Load", n);
+    for (size_t run = 0; run < n; ++run){
+      if (summaries[run]){
+        for (const auto& zone : summaries[run]->zoneCoolingLoads){
+          addValue(rows, start, QString::fromStdString(zone.first), summaries[run]->zoneLoadUnits, run, zone.second);
+        }
+      }
+    }
+
+    start = addSection(rows, "Zone Sensible Heating Design Load", n);
+    for (size_t run = 0; run < n; ++run){
+      if (summaries[run]){
+        for (const auto& zone : summaries[run]->zoneHeatingLoads){
+          addValue(rows, start, QString::fromStdString(zone.first), summaries[run]->zoneLoadUnits, run, zone.second);
+        }
+      }
+    }
+
+    // drop end uses no run has and the sections left empty
+    rows.erase(std::remove_if(rows.begin(), rows.end(), [](const ComparisonRow& row){
+      return !row.section && std::none_of(row.values.begin(), row.values.end(), [](const boost::optional<double>& value){
+        return value && (*value != 0.0);
+      });
+    }), rows.end());
+
+    std::vector<ComparisonRow> result;
+    for (size_t i = 0; i < rows.size(); ++i){
+      if (rows[i].section && ((i + 1 == rows.size()) || rows[i + 1].section)){
+        continue;
+      }
+      result.push_back(rows[i]);
+    }
+    return result;
+  }
+
+}
+
+ResultsComparisonView::ResultsComparisonView(QWidget * parent)
+  : QWidget(parent),
+    m_isIP(true),
+    m_requeryPending(false),
+    m_runList(new QListWidget()),
+    m_statusLabel(new QLabel()),
+    m_table(new QTableWidget())
+{
+  auto mainLayout = new QHBoxLayout();
+  mainLayout->setContentsMargins(0, 0, 0, 0);
+  setLayout(mainLayout);
+
+  auto runsLayout = new QVBoxLayout();
+  auto label = new QLabel("Runs: ");
+  label->setObjectName("H2");
+  runsLayout->addWidget(label);
+  m_runList->setMaximumWidth(250);
+  m_runList->setToolTip("The first checked run is the baseline of the differences");
+  runsLayout->addWidget(m_runList);
+  mainLayout->addLayout(runsLayout);
+
+  auto tableLayout = new QVBoxLayout();
+  tableLayout->addWidget(m_statusLabel);
+  m_table->setEditTriggers(QAbstractItemView::NoEditTriggers);
+  m_table->setSelectionMode(QAbstractItemView::NoSelection);
+  m_table->horizontalHeader()->setSectionResizeMode(QHeaderView::ResizeToContents);
+  m_table->verticalHeader()->setSectionResizeMode(QHeaderView::ResizeToContents);
+  tableLayout->addWidget(m_table);
+  mainLayout->addLayout(tableLayout, 1);
+
+  connect(m_runList, &QListWidget::itemChanged, this, &ResultsComparisonView::onRunItemChanged);
+  connect(&m_queryWatcher, &QFutureWatcher<ResultsSummary>::resultReadyAt, this, &ResultsComparisonView::onResultReady);
+  connect(&m_queryWatcher, &QFutureWatcher<ResultsSummary>::finished, this, &ResultsComparisonView::onQueriesFinished);
+}
+
+ResultsComparisonView::~ResultsComparisonView()
+{
+  m_queryWatcher.cancel();
+  m_queryWatcher.waitForFinished();
+}
+
+void ResultsComparisonView::setRuns(const std::vector<std::pair<QString, openstudio::path>>& runs)
+{
+  if (runs == m_runs){
+    return;
+  }
+
+  m_runs = runs;
+
+  m_runList->blockSignals(true);
+  m_runList->clear();
+  for (size_t i = 0; i < m_runs.size(); ++i){
+    auto item = new QListWidgetItem(m_runs[i].first);
+    item->setFlags(item->flags() | Qt::ItemIsUserCheckable);
+    item->setCheckState(Qt::Checked);
+    item->setToolTip(toQString(m_runs[i].second));
+    item->setData(Qt::UserRole, static_cast<int>(i));
+    m_runList->addItem(item);
+  }
+  m_runList->blockSignals(false);
+
+  refreshTable();
+  queryRuns();
+}
+
+void ResultsComparisonView::setIsIP(bool isIP)
+{
+  m_isIP = isIP;
+  refreshTable();
+}
+
+void ResultsComparisonView::showEvent(QShowEvent * event)
+{
+  QWidget::showEvent(event);
+  queryRuns();
+}
+
+void ResultsComparisonView::onRunItemChanged(QListWidgetItem * item)
+{
+  refreshTable();
+  queryRuns();
+}
+
+void ResultsComparisonView::queryRuns()
+{
+  if (!isVisible()){
+    return;
+  }
+
+  if (m_queryWatcher.isRunning()){
+    m_requeryPending = true;
+    return;
+  }
+
+  std::vector<openstudio::path> sqlFiles;
+  std::set<std::string> keys;
+  m_queryKeys.clear();
+  for (int i = 0; i < m_runList->count(); ++i){
+    QListWidgetItem * item = m_runList->item(i);
+    if (item->checkState() != Qt::Checked){
+      continue;
+    }
+    const openstudio::path& sqlFile = m_runs[item->data(Qt::UserRole).toInt()].second;
+    std::string key = resultsSummaryKey(sqlFile);
+    if (!cachedResultsSummary(key) && keys.insert(key).second){
+      sqlFiles.push_back(sqlFile);
+      m_queryKeys.push_back(key);
+    }
+  }
+
+  if (sqlFiles.empty()){
+    m_statusLabel->clear();
+    return;
+  }
+
+  m_statusLabel->setText(QString("Reading ") + QString::number(sqlFiles.size()) + QString(" runs..."));
+
+  // each file has its own connection on its own worker thread
+  m_queryWatcher.setFuture(QtConcurrent::mapped(sqlFiles, queryResultsSummary));
+}
+
+void ResultsComparisonView::onResultReady(int index)
+{
+  cacheResultsSummary(m_queryKeys[index], m_queryWatcher.resultAt(index));
+  refreshTable();
+}
+
+void ResultsComparisonView::onQueriesFinished()
+{
+  if (m_requeryPending){
+    m_requeryPending = false;
+    queryRuns();
+    return;
+  }
+
+  m_statusLabel->clear();
+}
+
+void ResultsComparisonView::refreshTable()
+{
+  std::vector<QString> labels;
+  std::vector<boost::optional<ResultsSummary>> summaries;
+  for (int i = 0; i < m_runList->count(); ++i){
+    QListWidgetItem * item = m_runList->item(i);
+    if (item->checkState() == Qt::Checked){
+      const auto& run = m_runs[item->data(Qt::UserRole).toInt()];
+      labels.push_back(run.first);
+      summaries.push_back(cachedResultsSummary(resultsSummaryKey(run.second)));
+    }
+  }
+
+  std::vector<ComparisonRow> rows = comparisonRows(summaries);
+
+  m_table->clear();
+  m_table->clearSpans();
+  m_table->setColumnCount(static_cast<int>(labels.size()));
+  m_table->setRowCount(static_cast<int>(rows.size()));
+
+  for (size_t c = 0; c < labels.size(); ++c){
+    QString header = labels[c];
+    if (!summaries[c]){
+      header += QString("\n(reading)");
+    } else if (!summaries[c]->error.isEmpty()){
+      header += QString("\n(no results)");
+    }
+    auto headerItem = new QTableWidgetItem(header);
+    if (summaries[c]){
+      headerItem->setToolTip(summaries[c]->error);
+    }
+    m_table->setHorizontalHeaderItem(static_cast<int>(c), headerItem);
+  }
+
+  QFont sectionFont = m_table->font();
+  sectionFont.setBold(true);
+
+  for (size_t r = 0; r < rows.size(); ++r){
+    const ComparisonRow& row = rows[r];
+    int tableRow = static_cast<int>(r);
+
+    if (row.section){
+      auto headerItem = new QTableWidgetItem(row.label);
+      headerItem->setFont(sectionFont);
+      m_table->setVerticalHeaderItem(tableRow, headerItem);
+      if (labels.size() > 1){
+        m_table->setSpan(tableRow, 0, 1, static_cast<int>(labels.size()));
+      }
+      continue;
+    }
+
+    std::string displayUnits = row.units;
+    std::vector<boost::optional<double>> values;
+    for (const auto& value : row.values){
+      if (value){
+        values.push_back(displayResultsValue(*value, row.units, m_isIP, displayUnits));
+      } else{
+        values.push_back(boost::none);
+      }
+    }
+
+    QString label = row.label;
+    if (!displayUnits.empty()){
+      label += QString(" [") + QString::fromStdString(displayUnits) + QString("]");
+    }
+    m_table->setVerticalHeaderItem(tableRow, new QTableWidgetItem(label));
+
+    // differences are to the first run
+    for (size_t c = 0; c < values.size(); ++c){
+      QString text;
+      if (values[c]){
+        text = formatResultsValue(*values[c]);
+        if ((c > 0) && values[0]){
+          double delta = *values[c] - *values[0];
+          text += QString("\n") + ((delta >= 0.0) ? QString("+") : QString()) + formatResultsValue(delta);
+          if (*values[0] != 0.0){
+            double percent = 100.0 * delta / std::abs(*values[0]);
+            text += QString(" (") + ((percent >= 0.0) ? QString("+") : QString()) + QString::number(percent, 'f', 1) + QString("%)");
+          }
+        }
+      } else if (summaries[c]){
+        text = QString("-");
+      }
+
+      auto item = new QTableWidgetItem(text);
+      item->setTextAlignment(Qt::AlignRight | Qt::AlignVCenter);
+      m_table->setItem(tableRow, static_cast<int>(c), item);
+    }
+  }
+}
+
+} // openstudio
@@ -0,0 +1,99 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef OPENSTUDIO_RESULTSCOMPARISONVIEW_HPP
+#define OPENSTUDIO_RESULTSCOMPARISONVIEW_HPP
+
+#include "ResultsDashboardView.hpp"
+
+#include <openstudio/utilities/core/Logger.hpp>
+#include <openstudio/utilities/core/Path.hpp>
+
+#include <QWidget>
+#include <QFutureWatcher>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+class QLabel;
+class QListWidget;
+class QListWidgetItem;
+class QTableWidget;
+
+namespace openstudio {
+
+// key results of several runs side by side with their differences to the first one, the sql files are queried in
+// parallel, one per worker thread
+class ResultsComparisonView : public QWidget
+{
+  Q_OBJECT;
+
+  public:
+    ResultsComparisonView(QWidget * parent = nullptr);
+    virtual ~ResultsComparisonView();
+
+    // label and eplusout.sql of each run that can be compared
+    void setRuns(const std::vector<std::pair<QString, openstudio::path>>& runs);
+
+    void setIsIP(bool isIP);
+
+  protected:
+    void showEvent(QShowEvent * event) override;
+
+  private slots:
+    void onRunItemChanged(QListWidgetItem * item);
+    void onResultReady(int index);
+    void onQueriesFinished();
+
+  private:
+    REGISTER_LOGGER("openstudio::ResultsComparisonView");
+
+    // queries the checked runs that are not cached yet
+    void queryRuns();
+
+    void refreshTable();
+
+    bool m_isIP;
+
+    std::vector<std::pair<QString, openstudio::path>> m_runs;
+
+    // cache keys of the files being queried, in the order of the results
+    std::vector<std::string> m_queryKeys;
+    bool m_requeryPending;
+    QFutureWatcher<ResultsSummary> m_queryWatcher;
+
+    QListWidget * m_runList;
+    QLabel * m_statusLabel;
+    QTableWidget * m_table;
+};
+
+} // openstudio
+
+#endif // OPENSTUDIO_RESULTSCOMPARISONVIEW_HPP
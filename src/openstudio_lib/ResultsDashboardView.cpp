@@ -0,0 +1,466 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "ResultsDashboardView.hpp"
+
+#include "../model_editor/Utilities.hpp"
+
+#include <openstudio/utilities/sql/SqlFile.hpp>
+#include <openstudio/utilities/units/QuantityConverter.hpp>
+
+#include <QBoxLayout>
+#include <QFileInfo>
+#include <QHeaderView>
+#include <QLabel>
+#include <QLocale>
+#include <QTableWidget>
+#include <QtConcurrent>
+
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <map>
+
+namespace openstudio {
+
+namespace {
+
+  struct TabularCell
+  {
+    std::string row;
+    std::string column;
+    std::string units;
+    double value;
+  };
+
+  // SqlFile only returns single columns, the fields of a cell come back joined by the unit separator so that a table
+  // takes one pass over the view
+  const char tabularFieldSeparator = '\x1f';
+
+  const std::string& tabularStatement()
+  {
+    static const std::string statement = "SELECT RowName || char(31) || ColumnName || char(31) || IFNULL(Units, '') || char(31) || Value "
+                                         "FROM TabularDataWithStrings WHERE ReportName=? AND ReportForString=? AND TableName=?";
+    return statement;
+  }
+
+  // numeric cells of a table of the Entire Facility tabular reports
+  std::vector<TabularCell> queryTable(const SqlFile& sqlFile, const std::string& reportName, const std::string& tableName)
+  {
+    std::vector<TabularCell> result;
+
+    boost::optional<std::vector<std::string>> rows = sqlFile.execAndReturnVectorOfString(tabularStatement(), reportName, std::string("Entire Facility"), tableName);
+    if (!rows){
+      return result;
+    }
+
+    for (const auto& row : *rows){
+      QStringList fields = QString::fromStdString(row).split(QChar(tabularFieldSeparator));
+      if (fields.size() != 4){
+        continue;
+      }
+      bool ok = false;
+      double value = fields[3].trimmed().toDouble(&ok);
+      if (ok){
+        result.push_back(TabularCell{toString(fields[0]), toString(fields[1]), toString(fields[2]), value});
+      }
+    }
+    return result;
+  }
+
+  // the comparison view reads every run of a project, older summaries are dropped past this
+  const size_t maxCachedSummaries = 32;
+
+  struct SummaryCache
+  {
+    std::map<std::string, ResultsSummary> summaries;
+    // oldest first
+    std::deque<std::string> keys;
+  };
+
+  SummaryCache& summaryCache()
+  {
+    static SummaryCache cache;
+    return cache;
+  }
+
+  // the unit strings of the tabular reports are not all understood by convert
+  std::string convertibleUnits(const std::string& units)
+  {
+    if (units == "m3"){
+      return "m^3";
+    }
+    return units;
+  }
+
+  std::string ipUnits(const std::string& units)
+  {
+    static const std::map<std::string, std::string> siToIP{
+      {"GJ", "kBtu"},
+      {"MJ", "kBtu"},
+      {"W", "kBtu/h"},
+      {"m3", "gal"}
+    };
+
+    auto it = siToIP.find(units);
+    if (it != siToIP.end()){
+      return it->second;
+    }
+    return units;
+  }
+
+}
+
+ResultsSummary queryResultsSummary(const openstudio::path& sqlFile)
+{
+  ResultsSummary result;
+  result.sqlFile = sqlFile;
+
+  try {
+    // a few tabular queries do not need the file to be indexed
+    SqlFile sql(sqlFile, false);
+    if (!sql.connectionOpen()){
+      result.error = QString("Could not open ") + toQString(sqlFile);
+      return result;
+    }
+
+    for (const auto& cell : queryTable(sql, "AnnualBuildingUtilityPerformanceSummary", "Site and Source Energy")){
+      if ((cell.row == "Net Site Energy") && (cell.column == "Total Energy")){
+        result.netSiteEnergy = cell.value;
+        result.netSiteEnergyUnits = cell.units;
+      }
+    }
+
+    for (const auto& cell : queryTable(sql, "AnnualBuildingUtilityPerformanceSummary", "End Uses")){
+      auto fuel = std::find(result.fuels.begin(), result.fuels.end(), cell.column);
+      if (fuel == result.fuels.end()){
+        result.fuels.push_back(cell.column);
+        result.fuelUnits.push_back(cell.units);
+        for (auto& endUse : result.endUses){
+          endUse.second.push_back(0.0);
+        }
+        fuel = result.fuels.end() - 1;
+      }
+
+      auto endUse = std::find_if(result.endUses.begin(), result.endUses.end(), [&cell](const std::pair<std::string, std::vector<double>>& row){
+        return row.first == cell.row;
+      });
+      if (endUse == result.endUses.end()){
+        result.endUses.push_back(std::make_pair(cell.row, std::vector<double>(result.fuels.size(), 0.0)));
+        endUse = result.endUses.end() - 1;
+      }
+
+      endUse->second[fuel - result.fuels.begin()] = cell.value;
+    }
+
+    result.peakDemands.resize(result.fuels.size(), 0.0);
+    result.peakDemandUnits.resize(result.fuels.size());
+    for (const auto& cell : queryTable(sql, "DemandEndUseComponentsSummary", "End Uses")){
+      if (cell.row != "Total End Uses"){
+        continue;
+      }
+      auto fuel = std::find(result.fuels.begin(), result.fuels.end(), cell.column);
+      if (fuel != result.fuels.end()){
+        result.peakDemands[fuel - result.fuels.begin()] = cell.value;
+        result.peakDemandUnits[fuel - result.fuels.begin()] = cell.units;
+      }
+    }
+
+    for (const auto& cell : queryTable(sql, "AnnualBuildingUtilityPerformanceSummary", "Comfort and Setpoint Not Met Summary")){
+      if (cell.column != "Facility"){
+        continue;
+      }
+      if (cell.row == "Time Setpoint Not Met During Occupied Heating"){
+        result.hoursHeatingNotMet = cell.value;
+      } else if (cell.row == "Time Setpoint Not Met During Occupied Cooling"){
+        result.hoursCoolingNotMet = cell.value;
+      }
+    }
+
+    for (const auto& cell : queryTable(sql, "HVACSizingSummary", "Zone Sensible Cooling")){
+      if (cell.column == "Calculated Design Load"){
+        result.zoneCoolingLoads.push_back(std::make_pair(cell.row, cell.value));
+        result.zoneLoadUnits = cell.units;
+      }
+    }
+    for (const auto& cell : queryTable(sql, "HVACSizingSummary", "Zone Sensible Heating")){
+      if (cell.column == "Calculated Design Load"){
+        result.zoneHeatingLoads.push_back(std::make_pair(cell.row, cell.value));
+        result.zoneLoadUnits = cell.units;
+      }
+    }
+
+    if (!result.netSiteEnergy && result.endUses.empty()){
+      result.error = QString("No annual results found in ") + toQString(sqlFile.filename());
+    }
+  } catch (const std::exception& e) {
+    result.error = QString("Could not read ") + toQString(sqlFile) + QString(": ") + QString::fromStdString(e.what());
+  }
+
+  return result;
+}
+
+std::string resultsSummaryKey(const openstudio::path& sqlFile)
+{
+  QFileInfo fileInfo(toQString(sqlFile));
+  return toString(fileInfo.absoluteFilePath()) + "|" + std::to_string(fileInfo.size()) + "|" + std::to_string(fileInfo.lastModified().toMSecsSinceEpoch());
+}
+
+boost::optional<ResultsSummary> cachedResultsSummary(const std::string& key)
+{
+  const SummaryCache& cache = summaryCache();
+  auto it = cache.summaries.find(key);
+  if (it != cache.summaries.end()){
+    return it->second;
+  }
+  return boost::none;
+}
+
+void cacheResultsSummary(const std::string& key, const ResultsSummary& summary)
+{
+  SummaryCache& cache = summaryCache();
+  if (cache.summaries.find(key) == cache.summaries.end()){
+    cache.keys.push_back(key);
+  }
+  cache.summaries[key] = summary;
+
+  while (cache.keys.size() > maxCachedSummaries){
+    cache.summaries.erase(cache.keys.front());
+    cache.keys.pop_front();
+  }
+}
+
+double displayResultsValue(double value, const std::string& units, bool isIP, std::string& displayUnits)
+{
+  displayUnits = units;
+  if (isIP){
+    std::string toUnits = ipUnits(units);
+    boost::optional<double> converted = convert(value, convertibleUnits(units), toUnits);
+    if (converted){
+      displayUnits = toUnits;
+      return *converted;
+    }
+  }
+  return value;
+}
+
+QString formatResultsValue(double value)
+{
+  int precision = (std::abs(value) >= 100.0) ? 0 : 2;
+  return QLocale().toString(value, 'f', precision);
+}
+
+ResultsDashboardView::ResultsDashboardView(QWidget * parent)
+  : QWidget(parent),
+    m_isIP(true),
+    m_statusLabel(new QLabel()),
+    m_netSiteEnergyLabel(new QLabel()),
+    m_unmetHoursLabel(new QLabel()),
+    m_endUsesTable(new QTableWidget())
+{
+  auto mainLayout = new QVBoxLayout();
+  mainLayout->setContentsMargins(0, 0, 0, 0);
+  setLayout(mainLayout);
+
+  auto keyFiguresLayout = new QHBoxLayout();
+  m_netSiteEnergyLabel->setObjectName("H2");
+  keyFiguresLayout->addWidget(m_netSiteEnergyLabel);
+  keyFiguresLayout->addSpacing(20);
+  m_unmetHoursLabel->setObjectName("H2");
+  keyFiguresLayout->addWidget(m_unmetHoursLabel);
+  keyFiguresLayout->addStretch();
+  keyFiguresLayout->addWidget(m_statusLabel);
+  mainLayout->addLayout(keyFiguresLayout);
+
+  m_endUsesTable->setEditTriggers(QAbstractItemView::NoEditTriggers);
+  m_endUsesTable->setSelectionMode(QAbstractItemView::NoSelection);
+  m_endUsesTable->horizontalHeader()->setSectionResizeMode(QHeaderView::ResizeToContents);
+  m_endUsesTable->verticalHeader()->setSectionResizeMode(QHeaderView::ResizeToContents);
+  m_endUsesTable->setVerticalScrollBarPolicy(Qt::ScrollBarAsNeeded);
+  m_endUsesTable->setMaximumHeight(220);
+  mainLayout->addWidget(m_endUsesTable);
+
+  connect(&m_queryWatcher, &QFutureWatcher<ResultsSummary>::finished, this, &ResultsDashboardView::onQueryFinished);
+
+  setSqlFile(openstudio::path());
+}
+
+ResultsDashboardView::~ResultsDashboardView()
+{
+  m_queryWatcher.waitForFinished();
+}
+
+void ResultsDashboardView::setSqlFile(const openstudio::path& sqlFile)
+{
+  m_sqlFile = sqlFile;
+  m_summary.reset();
+
+  m_netSiteEnergyLabel->clear();
+  m_unmetHoursLabel->clear();
+  m_endUsesTable->clear();
+  m_endUsesTable->setRowCount(0);
+  m_endUsesTable->setColumnCount(0);
+  m_endUsesTable->setVisible(false);
+
+  if (m_sqlFile.empty() || !openstudio::filesystem::exists(m_sqlFile)){
+    m_statusLabel->setText("No simulation results");
+    return;
+  }
+
+  boost::optional<ResultsSummary> cached = cachedResultsSummary(resultsSummaryKey(m_sqlFile));
+  if (cached){
+    showSummary(*cached);
+    return;
+  }
+
+  m_statusLabel->setText("Reading results...");
+
+  // the running query is checked against m_sqlFile when it finishes
+  if (!m_queryWatcher.isRunning()){
+    m_queryKey = resultsSummaryKey(m_sqlFile);
+    m_queryWatcher.setFuture(QtConcurrent::run(queryResultsSummary, m_sqlFile));
+  }
+}
+
+void ResultsDashboardView::setIsIP(bool isIP)
+{
+  m_isIP = isIP;
+  if (m_summary){
+    showSummary(*m_summary);
+  }
+}
+
+void ResultsDashboardView::onQueryFinished()
+{
+  ResultsSummary summary = m_queryWatcher.result();
+  cacheResultsSummary(m_queryKey, summary);
+
+  if (summary.sqlFile != m_sqlFile){
+    setSqlFile(m_sqlFile);
+    return;
+  }
+
+  showSummary(summary);
+}
+
+QString ResultsDashboardView::formatValue(double value, const std::string& units, bool showUnits) const
+{
+  std::string displayUnits;
+  QString result = formatResultsValue(displayResultsValue(value, units, m_isIP, displayUnits));
+  if (showUnits && !displayUnits.empty()){
+    result += QString(" ") + QString::fromStdString(displayUnits);
+  }
+  return result;
+}
+
+void ResultsDashboardView::showSummary(const ResultsSummary& summary)
+{
+  m_summary = summary;
+
+  if (!summary.error.isEmpty()){
+    m_statusLabel->setText(summary.error);
+    return;
+  }
+  m_statusLabel->clear();
+
+  if (summary.netSiteEnergy){
+    m_netSiteEnergyLabel->setText(QString("Net Site Energy: ") + formatValue(*summary.netSiteEnergy, summary.netSiteEnergyUnits));
+  }
+
+  if (summary.hoursHeatingNotMet || summary.hoursCoolingNotMet){
+    QString text("Unmet Hours:");
+    if (summary.hoursHeatingNotMet){
+      text += QString(" Heating ") + QLocale().toString(*summary.hoursHeatingNotMet, 'f', 0);
+    }
+    if (summary.hoursCoolingNotMet){
+      text += QString(" Cooling ") + QLocale().toString(*summary.hoursCoolingNotMet, 'f', 0);
+    }
+    m_unmetHoursLabel->setText(text);
+  }
+
+  // only fuels and end uses that have any consumption
+  std::vector<size_t> fuels;
+  for (size_t j = 0; j < summary.fuels.size(); ++j){
+    bool used = (summary.peakDemands[j] != 0.0);
+    for (const auto& endUse : summary.endUses){
+      used = used || (endUse.second[j] != 0.0);
+    }
+    if (used){
+      fuels.push_back(j);
+    }
+  }
+
+  std::vector<size_t> endUses;
+  for (size_t i = 0; i < summary.endUses.size(); ++i){
+    for (const auto& j : fuels){
+      if (summary.endUses[i].second[j] != 0.0){
+        endUses.push_back(i);
+        break;
+      }
+    }
+  }
+
+  if (fuels.empty()){
+    return;
+  }
+
+  int columnCount = static_cast<int>(fuels.size());
+  int rowCount = static_cast<int>(endUses.size());
+  m_endUsesTable->setColumnCount(columnCount);
+  m_endUsesTable->setRowCount(rowCount + 1);
+
+  for (int c = 0; c < columnCount; ++c){
+    size_t j = fuels[c];
+    std::string units;
+    displayResultsValue(0.0, summary.fuelUnits[j], m_isIP, units);
+    m_endUsesTable->setHorizontalHeaderItem(c, new QTableWidgetItem(QString::fromStdString(summary.fuels[j]) + QString("\n[") + QString::fromStdString(units) + QString("]")));
+  }
+
+  for (int r = 0; r < rowCount; ++r){
+    const auto& endUse = summary.endUses[endUses[r]];
+    m_endUsesTable->setVerticalHeaderItem(r, new QTableWidgetItem(QString::fromStdString(endUse.first)));
+    for (int c = 0; c < columnCount; ++c){
+      // units are in the column header
+      auto item = new QTableWidgetItem(formatValue(endUse.second[fuels[c]], summary.fuelUnits[fuels[c]], false));
+      item->setTextAlignment(Qt::AlignRight | Qt::AlignVCenter);
+      m_endUsesTable->setItem(r, c, item);
+    }
+  }
+
+  m_endUsesTable->setVerticalHeaderItem(rowCount, new QTableWidgetItem("Peak Demand"));
+  for (int c = 0; c < columnCount; ++c){
+    auto item = new QTableWidgetItem(formatValue(summary.peakDemands[fuels[c]], summary.peakDemandUnits[fuels[c]]));
+    item->setTextAlignment(Qt::AlignRight | Qt::AlignVCenter);
+    m_endUsesTable->setItem(rowCount, c, item);
+  }
+
+  m_endUsesTable->setVisible(true);
+}
+
+} // openstudio
@@ -0,0 +1,133 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef OPENSTUDIO_RESULTSDASHBOARDVIEW_HPP
+#define OPENSTUDIO_RESULTSDASHBOARDVIEW_HPP
+
+#include <openstudio/utilities/core/Logger.hpp>
+#include <openstudio/utilities/core/Path.hpp>
+
+#include <QWidget>
+#include <QFutureWatcher>
+
+#include <boost/optional.hpp>
+
+#include <string>
+#include <vector>
+
+class QLabel;
+class QTableWidget;
+
+namespace openstudio {
+
+// Key results of one run, read from the tabular reports in its eplusout.sql. Values are in the units of the
+// report, which are given alongside.
+struct ResultsSummary
+{
+  openstudio::path sqlFile;
+  QString error;
+
+  boost::optional<double> netSiteEnergy;
+  std::string netSiteEnergyUnits;
+
+  // end use rows by fuel column of the annual building utility performance summary
+  std::vector<std::string> fuels;
+  std::vector<std::string> fuelUnits;
+  std::vector<std::pair<std::string, std::vector<double>>> endUses;
+
+  // demand of each fuel at the time of its peak
+  std::vector<double> peakDemands;
+  std::vector<std::string> peakDemandUnits;
+
+  boost::optional<double> hoursHeatingNotMet;
+  boost::optional<double> hoursCoolingNotMet;
+
+  // sensible design loads of each zone from the HVAC sizing summary
+  std::vector<std::pair<std::string, double>> zoneCoolingLoads;
+  std::vector<std::pair<std::string, double>> zoneHeatingLoads;
+  std::string zoneLoadUnits;
+};
+
+// opens sqlFile and runs the summary queries, safe to call from a worker thread
+ResultsSummary queryResultsSummary(const openstudio::path& sqlFile);
+
+// the most recent summaries are kept for the session under a key made of the path, size and modification time of the sql file, so
+// redoing a run invalidates its entry, only to be used from the GUI thread
+std::string resultsSummaryKey(const openstudio::path& sqlFile);
+boost::optional<ResultsSummary> cachedResultsSummary(const std::string& key);
+void cacheResultsSummary(const std::string& key, const ResultsSummary& summary);
+
+// value converted to IP units if isIP and its units have an IP counterpart, displayUnits is set to the units of the result
+double displayResultsValue(double value, const std::string& units, bool isIP, std::string& displayUnits);
+
+QString formatResultsValue(double value);
+
+// native summary of the results shown above the reports, queries run on a worker thread and are cached per run
+class ResultsDashboardView : public QWidget
+{
+  Q_OBJECT;
+
+  public:
+    ResultsDashboardView(QWidget * parent = nullptr);
+    virtual ~ResultsDashboardView();
+
+    // an empty path clears the dashboard
+    void setSqlFile(const openstudio::path& sqlFile);
+
+    void setIsIP(bool isIP);
+
+  private slots:
+    void onQueryFinished();
+
+  private:
+    REGISTER_LOGGER("openstudio::ResultsDashboardView");
+
+    void showSummary(const ResultsSummary& summary);
+
+    // converts to IP units when showing IP
+    QString formatValue(double value, const std::string& units, bool showUnits = true) const;
+
+    bool m_isIP;
+
+    openstudio::path m_sqlFile;
+    boost::optional<ResultsSummary> m_summary;
+
+    // cache key of the run being queried, taken when the query starts
+    std::string m_queryKey;
+    QFutureWatcher<ResultsSummary> m_queryWatcher;
+
+    QLabel * m_statusLabel;
+    QLabel * m_netSiteEnergyLabel;
+    QLabel * m_unmetHoursLabel;
+    QTableWidget * m_endUsesTable;
+};
+
+} // openstudio
+
+#endif // OPENSTUDIO_RESULTSDASHBOARDVIEW_HPP
@@ -28,6 +28,9 @@
 ***********************************************************************************************************************/
 
 #include "ResultsTabView.hpp"
+#include "ResultsComparisonView.hpp"
+#include "ResultsDashboardView.hpp"
+#include "ResultsTimeSeriesView.hpp"
 #include "OSDocument.hpp"
 #include "../openstudio_app/OpenStudioApp.hpp"
 #include "OSAppBase.hpp"
@@ -64,7 +67,8 @@ ResultsTabView::ResultsTabView(const QString & tabLabel,
     openstudio::path companionFolder = getCompanionFolder( toPath(savePath) );
     openstudio::path runPath = companionFolder / toPath("run");
     openstudio::path reportsPath = companionFolder / toPath("reports");
-    m_resultsView->searchForExistingResults(runPath, reportsPath);
+    openstudio::path variantsPath = companionFolder / toPath("variants");
+    m_resultsView->searchForExistingResults(runPath, reportsPath, variantsPath);
   }
 }
 
@@ -81,7 +85,9 @@ ResultsView::ResultsView(QWidget *t_parent)
     m_isIP(true),
     m_progressBar(new QProgressBar()),
     m_refreshBtn(new QPushButton("Refresh")),
-    m_openDViewBtn(new QPushButton("Open DView for\nDetailed Reports"))
+    m_openDViewBtn(new QPushButton("Open DView for\nDetailed Reports")),
+    m_timeSeriesBtn(new QPushButton("Time Series")),
+    m_compareBtn(new QPushButton("Compare Runs"))
 {
 
   auto mainLayout = new QVBoxLayout;
@@ -129,10 +135,24 @@ ResultsView::ResultsView(QWidget *t_parent)
 
   hLayout->addWidget(m_openDViewBtn, 0, Qt::AlignVCenter);
 
+  // output variables plotted in the app, in place of the report
+  m_timeSeriesBtn->setCheckable(true);
+  connect(m_timeSeriesBtn, &QPushButton::toggled, this, &ResultsView::timeSeriesToggled);
+  hLayout->addWidget(m_timeSeriesBtn, 0, Qt::AlignVCenter);
+
+  // key results of the main run and its variants side by side
+  m_compareBtn->setCheckable(true);
+  connect(m_compareBtn, &QPushButton::toggled, this, &ResultsView::compareToggled);
+  hLayout->addWidget(m_compareBtn, 0, Qt::AlignVCenter);
+
   // Add the Top portion to the main layout
   mainLayout->addLayout(hLayout);
   // mainLayout->addStretch(0);
 
+  // key results straight from the sql file, available before any report has loaded
+  m_dashboard = new ResultsDashboardView(this);
+  mainLayout->addWidget(m_dashboard);
+
   // create a web widget
   m_view = new QWebEngineView(this);
   m_view->settings()->setAttribute(QWebEngineSettings::WebAttribute::LocalContentCanAccessRemoteUrls, true);
@@ -156,6 +176,14 @@ ResultsView::ResultsView(QWidget *t_parent)
   //mainLayout->addWidget(m_view, 10, Qt::AlignTop);
   mainLayout->addWidget(m_view);
 
+  m_timeSeriesView = new ResultsTimeSeriesView(this);
+  m_timeSeriesView->setVisible(false);
+  mainLayout->addWidget(m_timeSeriesView);
+
+  m_comparisonView = new ResultsComparisonView(this);
+  m_comparisonView->setVisible(false);
+  mainLayout->addWidget(m_comparisonView);
+
 }
 
 ResultsView::~ResultsView()
@@ -169,6 +197,24 @@ void ResultsView::refreshClicked()
   m_view->triggerPageAction(QWebEnginePage::ReloadAndBypassCache);
 }
 
+void ResultsView::timeSeriesToggled(bool checked)
+{
+  if (checked) {
+    m_compareBtn->setChecked(false);
+  }
+  m_view->setVisible(!checked && !m_compareBtn->isChecked());
+  m_timeSeriesView->setVisible(checked);
+}
+
+void ResultsView::compareToggled(bool checked)
+{
+  if (checked) {
+    m_timeSeriesBtn->setChecked(false);
+  }
+  m_view->setVisible(!checked && !m_timeSeriesBtn->isChecked());
+  m_comparisonView->setVisible(checked);
+}
+
 void ResultsView::openDViewClicked()
 {
   LOG(Debug, "openDViewClicked");
@@ -203,6 +249,8 @@ void ResultsView::onUnitSystemChange(bool t_isIP)
 {
   LOG(Debug, "onUnitSystemChange " << t_isIP << " reloading results");
   m_isIP = t_isIP;
+  m_dashboard->setIsIP(t_isIP);
+  m_comparisonView->setIsIP(t_isIP);
   resultsGenerated(m_sqlFilePath, m_radianceResultsPath);
 }
 
@@ -241,7 +289,29 @@ struct ResultsPathSorter
   }
 };
 
-void ResultsView::searchForExistingResults(const openstudio::path &t_runDir, const openstudio::path &t_reportsDir)
+std::vector<openstudio::path> ResultsView::findReports(const openstudio::path &t_reportsDir)
+{
+  std::vector<openstudio::path> reports;
+
+  // Check that the directory does exists first
+  if (openstudio::filesystem::is_directory(t_reportsDir)
+    && openstudio::filesystem::exists(t_reportsDir)) {
+    for ( openstudio::filesystem::directory_iterator end, dir(t_reportsDir);
+          dir != end;
+          ++dir )
+    {
+      openstudio::path p = *dir;
+      if (openstudio::toString(p.extension()) == ".html" || openstudio::toString(p.extension()) == ".htm") {
+        reports.push_back(p);
+      }
+    }
+  }
+
+  return reports;
+}
+
+void ResultsView::searchForExistingResults(const openstudio::path &t_runDir, const openstudio::path &t_reportsDir,
+                                           const openstudio::path &t_variantsDir)
 {
   LOG(Debug, "Looking for existing results in: " << openstudio::toString(t_runDir));
 
@@ -271,16 +341,35 @@ void ResultsView::searchForExistingResults(const openstudio::path &t_runDir, con
 
   LOG(Debug, "Looking for existing results in: " << openstudio::toString(t_reportsDir));
 
-  // Check that the directory does exists first
-  if (openstudio::filesystem::is_directory(t_reportsDir)
-    && openstudio::filesystem::exists(t_reportsDir)) {
-    for ( openstudio::filesystem::directory_iterator end, dir(t_reportsDir);
+  reports = findReports(t_reportsDir);
+
+  m_variantReports.clear();
+  std::vector<std::pair<QString, openstudio::path>> variantRuns;
+  if (!t_variantsDir.empty()
+    && openstudio::filesystem::is_directory(t_variantsDir)) {
+    LOG(Debug, "Looking for variant results in: " << openstudio::toString(t_variantsDir));
+
+    std::vector<openstudio::path> variantDirs;
+    for ( openstudio::filesystem::directory_iterator end, dir(t_variantsDir);
           dir != end;
           ++dir )
     {
-      openstudio::path p = *dir;
-      if (openstudio::toString(p.extension()) == ".html" || openstudio::toString(p.extension()) == ".htm") {
-        reports.push_back(p);
+      if (openstudio::filesystem::is_directory(dir->path())) {
+        variantDirs.push_back(dir->path());
+      }
+    }
+    std::sort(variantDirs.begin(), variantDirs.end());
+
+    for (const openstudio::path& variantDir : variantDirs) {
+      std::vector<openstudio::path> variantReports = findReports(variantDir / toPath("reports"));
+      std::sort(variantReports.begin(), variantReports.end(), ResultsPathSorter());
+      for (const openstudio::path& report : variantReports) {
+        m_variantReports.push_back(std::make_pair(toQString(variantDir.filename()), report));
+      }
+
+      openstudio::path variantSql = variantDir / toPath("run") / toPath("eplusout.sql");
+      if (openstudio::filesystem::exists(variantSql)) {
+        variantRuns.push_back(std::make_pair(toQString(variantDir.filename()), variantSql));
       }
     }
   }
@@ -293,6 +382,18 @@ void ResultsView::searchForExistingResults(const openstudio::path &t_runDir, con
   openstudio::path eplus = eplusout.empty()?openstudio::path():eplusout.back();
   openstudio::path rad = radout.empty()?openstudio::path():radout.back();
 
+  // the newest run first as the baseline of the comparison, then older ones of the main run and the variants
+  std::vector<std::pair<QString, openstudio::path>> runs;
+  for (auto it = eplusout.rbegin(); it != eplusout.rend(); ++it) {
+    if (it == eplusout.rbegin()) {
+      runs.push_back(std::make_pair(QString("Current Run"), *it));
+    } else {
+      runs.push_back(std::make_pair(toQString(it->parent_path().filename()), *it));
+    }
+  }
+  runs.insert(runs.end(), variantRuns.begin(), variantRuns.end());
+  m_comparisonView->setRuns(runs);
+
   resultsGenerated(eplus, rad);
 
   populateComboBox(reports);
@@ -304,6 +405,9 @@ void ResultsView::resultsGenerated(const openstudio::path &t_path, const openstu
 
   m_sqlFilePath = t_path;
   m_radianceResultsPath = t_radianceResultsPath;
+
+  m_dashboard->setSqlFile(m_sqlFilePath);
+  m_timeSeriesView->setSqlFile(m_sqlFilePath);
 }
 
 //openstudio::runmanager::RunManager ResultsView::runManager()
@@ -355,50 +459,58 @@ void ResultsView::treeChanged(const openstudio::UUID &t_uuid)
   //}
 }
 
+void ResultsView::addReportToComboBox(const openstudio::path& report, const QString& prefix, unsigned& num)
+{
+  // Here we DO want to call MODELEDITOR_API QString toQString(const path&) overload, which should automatically
+  // convert that to a unix-style path (with forward slashes) which is what we do want here.
+  // fullPathString = toQString(report.string()); // This will mix slashes and backslashes (without escaping...) => C:/companion_folder\reports\eplustbl.html
+  // (Alternatively, we could just use QUrl::fromLocalFile in comboBoxChanged instead of manually preprending "file:///" here)
+  QString fullPathString = toQString(report);
+
+  QFile file(fullPathString);
+  fullPathString.prepend("file:///");
+
+  if (openstudio::toString(report.filename()) == "eplustbl.html" || openstudio::toString(report.filename()) == "eplustbl.htm"){
+
+    m_comboBox->addItem(prefix + "EnergyPlus Results",fullPathString);
+
+  }else{
+
+    ++num;
+
+    if (file.open(QFile::ReadOnly)){
+      QDomDocument doc;
+      doc.setContent(&file);
+      file.close();
+      QString string = doc.toString();
+      int startingIndex = string.indexOf("<title>");
+      int endingIndex = string.indexOf("</title>");
+      if((startingIndex == -1) || (endingIndex == -1) || (startingIndex >= endingIndex)){
+        m_comboBox->addItem(prefix + QString("Custom Report ") + QString::number(num), fullPathString);
+      } else {
+        // length of "<title>" = 7
+        QString title = string.mid(startingIndex+7, endingIndex-startingIndex-7);
+        m_comboBox->addItem(prefix + title,fullPathString);
+      }
+    }
+  }
+}
+
 void ResultsView::populateComboBox(std::vector<openstudio::path> reports)
 {
   unsigned num = 0;
-  QString fullPathString;
-  openstudio::path path;
 
   m_comboBox->clear();
   for (const openstudio::path& report : reports) {
+    addReportToComboBox(report, QString(), num);
+  }
 
-	// Here we DO want to call MODELEDITOR_API QString toQString(const path&) overload, which should automatically
-	// convert that to a unix-style path (with forward slashes) which is what we do want here.
-    // fullPathString = toQString(report.string()); // This will mix slashes and backslashes (without escaping...) => C:/companion_folder\reports\eplustbl.html
-	// (Alternatively, we could just use QUrl::fromLocalFile in comboBoxChanged instead of manually preprending "file:///" here)
-	fullPathString = toQString(report);
-
-
-    QFile file(fullPathString);
-    fullPathString.prepend("file:///");
-
-    if (openstudio::toString(report.filename()) == "eplustbl.html" || openstudio::toString(report.filename()) == "eplustbl.htm"){
-
-      m_comboBox->addItem("EnergyPlus Results",fullPathString);
-
-    }else{
-
-      ++num;
-
-      if (file.open(QFile::ReadOnly)){
-        QDomDocument doc;
-        doc.setContent(&file);
-        file.close();
-        QString string = doc.toString();
-        int startingIndex = string.indexOf("<title>");
-        int endingIndex = string.indexOf("</title>");
-        if((startingIndex == -1) || (endingIndex == -1) || (startingIndex >= endingIndex)){
-          m_comboBox->addItem(QString("Custom Report ") + QString::number(num), fullPathString);
-        } else {
-          // length of "<title>" = 7
-          QString title = string.mid(startingIndex+7, endingIndex-startingIndex-7);
-          m_comboBox->addItem(title,fullPathString);
-        }
-      }
-    }
+  // reports of variants are listed after the main run's, prefixed with the variant name
+  num = 0;
+  for (const auto& variantReport : m_variantReports) {
+    addReportToComboBox(variantReport.second, variantReport.first + ": ", num);
   }
+
   if(m_comboBox->count()){
     m_comboBox->setCurrentIndex(0);
     for (int i = 0; i < m_comboBox->count(); ++i){
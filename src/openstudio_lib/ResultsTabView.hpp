@@ -49,6 +49,10 @@ class QPushButton;
 
 namespace openstudio {
 
+  class ResultsComparisonView;
+  class ResultsDashboardView;
+  class ResultsTimeSeriesView;
+
   // main widget
 
   class ResultsView : public QWidget
@@ -58,7 +62,9 @@ namespace openstudio {
     public:
       ResultsView(QWidget *t_parent = nullptr);
       virtual ~ResultsView();
-      void searchForExistingResults(const openstudio::path &t_runDir, const openstudio::path &t_reportsDir);
+      // t_variantsDir contains one directory per variant run by the run tab's run queue, each with its own reports
+      void searchForExistingResults(const openstudio::path &t_runDir, const openstudio::path &t_reportsDir,
+                                    const openstudio::path &t_variantsDir = openstudio::path());
 
     public slots:
       void resultsGenerated(const openstudio::path &t_sqlFile, const openstudio::path &t_radianceResultsPath);
@@ -68,6 +74,8 @@ namespace openstudio {
     private slots:
       void refreshClicked();
       void openDViewClicked();
+      void timeSeriesToggled(bool checked);
+      void compareToggled(bool checked);
       void comboBoxChanged(int index);
 
       // DLM: for debugging
@@ -81,6 +89,13 @@ namespace openstudio {
       //openstudio::runmanager::RunManager runManager();
       void populateComboBox(std::vector<openstudio::path> reports);
 
+      void addReportToComboBox(const openstudio::path& report, const QString& prefix, unsigned& num);
+
+      static std::vector<openstudio::path> findReports(const openstudio::path &t_reportsDir);
+
+      // variant name and report path
+      std::vector<std::pair<QString, openstudio::path>> m_variantReports;
+
       bool m_isIP;
 
       // utility bill results
@@ -89,11 +104,17 @@ namespace openstudio {
       QProgressBar * m_progressBar;
       QPushButton * m_refreshBtn;
       QPushButton * m_openDViewBtn;
+      QPushButton * m_timeSeriesBtn;
+      QPushButton * m_compareBtn;
 
       openstudio::path m_dviewPath;
       openstudio::path m_sqlFilePath;
       openstudio::path m_radianceResultsPath;
 
+      ResultsDashboardView * m_dashboard;
+      ResultsTimeSeriesView * m_timeSeriesView;
+      ResultsComparisonView * m_comparisonView;
+
       QWebEngineView * m_view;
       OSWebEnginePage * m_page;
       QComboBox * m_comboBox;
@@ -0,0 +1,748 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "ResultsTimeSeriesView.hpp"
+#include "ResultsDashboardView.hpp"
+
+#include "../model_editor/Utilities.hpp"
+
+#include <openstudio/utilities/sql/SqlFile.hpp>
+
+#include <QBoxLayout>
+#include <QComboBox>
+#include <QDir>
+#include <QFile>
+#include <QLabel>
+#include <QLocale>
+#include <QMouseEvent>
+#include <QPainter>
+#include <QPushButton>
+#include <QTimer>
+#include <QUuid>
+#include <QWheelEvent>
+#include <QtConcurrent>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+// delay after the last zoom or pan before the visible window is queried at full resolution
+#define FETCH_DELAY_MSEC 150
+
+// buckets of the overview of a whole run period
+#define OVERVIEW_BUCKETS 2048
+
+namespace openstudio {
+
+namespace {
+
+  // hours from the start of the environment period at the end of each reporting interval
+  const std::string timeExpression = "((Time.SimulationDays - 1) * 24.0 + (Time.Hour - 1) + Time.Minute / 60.0)";
+
+  // bound to the dictionary index and twice to the run period, a negative run period includes all environments
+  const std::string fromReportData = " FROM ReportData INNER JOIN Time ON ReportData.TimeIndex = Time.TimeIndex"
+                                     " WHERE ReportData.ReportDataDictionaryIndex = ? AND (? < 0 OR Time.EnvironmentPeriodIndex = ?)";
+
+  // EnvironmentType of the run period in the EnvironmentPeriods table
+  const int runPeriodEnvironmentType = 3;
+
+  const std::vector<QColor> seriesColors{
+    QColor(31, 119, 180),
+    QColor(255, 127, 14),
+    QColor(44, 160, 44),
+    QColor(214, 39, 40),
+    QColor(148, 103, 189),
+    QColor(140, 86, 75),
+    QColor(227, 119, 194),
+    QColor(127, 127, 127)
+  };
+
+  QString timeLabel(double hours, double step)
+  {
+    int day = static_cast<int>(std::floor(hours / 24.0));
+    QString result = QString("Day ") + QString::number(day + 1);
+    if (step < 24.0){
+      int hour = static_cast<int>(std::round(hours - day * 24.0));
+      result += QString(" %1:00").arg(hour, 2, 10, QChar('0'));
+    }
+    return result;
+  }
+
+  QString seriesLabel(const TimeSeriesVariable& variable)
+  {
+    QString result;
+    if (!variable.keyValue.isEmpty()){
+      result += variable.keyValue + QString(": ");
+    }
+    result += variable.name;
+    if (!variable.units.isEmpty()){
+      result += QString(" [") + variable.units + QString("]");
+    }
+    return result;
+  }
+
+}
+
+TimeSeriesDictionary queryTimeSeriesDictionary(const openstudio::path& sqlFile)
+{
+  TimeSeriesDictionary result;
+  result.sqlFilePath = sqlFile;
+
+  try {
+    // queries run against a private copy, indexes on ReportData make the per variable queries fast but must not be
+    // written into the results file, and the CLI has to be able to delete run/ while the copy is open
+    QString copyPath = QDir::temp().filePath(QString("OpenStudioTimeSeries-") + QUuid::createUuid().toString().mid(1, 36) + QString(".sql"));
+    if (!QFile::copy(toQString(sqlFile), copyPath)){
+      result.error = QString("Could not copy ") + toQString(sqlFile);
+      return result;
+    }
+    result.sqlFile = std::shared_ptr<SqlFile>(new SqlFile(toPath(copyPath), true), [copyPath](SqlFile* copy){
+      delete copy;
+      QFile::remove(copyPath);
+    });
+    if (!result.sqlFile->connectionOpen()){
+      result.sqlFile.reset();
+      result.error = QString("Could not open ") + toQString(sqlFile);
+      return result;
+    }
+
+    boost::optional<int> runPeriod = result.sqlFile->execAndReturnFirstInt(
+      "SELECT EnvironmentPeriodIndex FROM EnvironmentPeriods WHERE EnvironmentType = ? ORDER BY EnvironmentPeriodIndex", runPeriodEnvironmentType);
+    if (runPeriod){
+      result.runPeriod = *runPeriod;
+    }
+
+    const std::string order = " FROM ReportDataDictionary ORDER BY Name, KeyValue, ReportingFrequency";
+    boost::optional<std::vector<int>> indices = result.sqlFile->execAndReturnVectorOfInt("SELECT ReportDataDictionaryIndex" + order);
+    boost::optional<std::vector<std::string>> keyValues = result.sqlFile->execAndReturnVectorOfString("SELECT KeyValue" + order);
+    boost::optional<std::vector<std::string>> names = result.sqlFile->execAndReturnVectorOfString("SELECT Name" + order);
+    boost::optional<std::vector<std::string>> frequencies = result.sqlFile->execAndReturnVectorOfString("SELECT ReportingFrequency" + order);
+    boost::optional<std::vector<std::string>> units = result.sqlFile->execAndReturnVectorOfString("SELECT Units" + order);
+
+    if (indices && keyValues && names && frequencies && units){
+      size_t n = std::min(std::min(indices->size(), keyValues->size()), std::min(std::min(names->size(), frequencies->size()), units->size()));
+      for (size_t i = 0; i < n; ++i){
+        TimeSeriesVariable variable;
+        variable.dictionaryIndex = (*indices)[i];
+        variable.keyValue = QString::fromStdString((*keyValues)[i]);
+        variable.name = QString::fromStdString((*names)[i]);
+        variable.frequency = QString::fromStdString((*frequencies)[i]);
+        variable.units = QString::fromStdString((*units)[i]);
+        result.variables.push_back(variable);
+      }
+    }
+
+    if (result.variables.empty()){
+      result.error = QString("No output variables in ") + toQString(sqlFile.filename());
+    }
+  } catch (const std::exception& e) {
+    result.sqlFile.reset();
+    result.error = QString("Could not read ") + toQString(sqlFile) + QString(": ") + QString::fromStdString(e.what());
+  }
+
+  return result;
+}
+
+TimeSeriesSamples queryTimeSeries(std::shared_ptr<SqlFile> sqlFile, int runPeriod, const TimeSeriesQuery& query)
+{
+  TimeSeriesSamples result;
+  result.dictionaryIndex = query.variable.dictionaryIndex;
+  result.x0 = query.x0;
+  result.x1 = query.x1;
+  result.buckets = query.buckets;
+
+  if (!sqlFile || (query.buckets <= 0)){
+    return result;
+  }
+
+  int index = query.variable.dictionaryIndex;
+
+  try {
+    if (query.overview){
+      boost::optional<double> x0 = sqlFile->execAndReturnFirstDouble("SELECT MIN(" + timeExpression + ")" + fromReportData, index, runPeriod, runPeriod);
+      boost::optional<double> x1 = sqlFile->execAndReturnFirstDouble("SELECT MAX(" + timeExpression + ")" + fromReportData, index, runPeriod, runPeriod);
+      if (!x0 || !x1){
+        return result;
+      }
+      result.x0 = *x0;
+      result.x1 = *x1;
+    }
+
+    // SQLite reduces the reports to a min and max per bucket, a zoomed in window has at most one report per bucket
+    double span = std::max(result.x1 - result.x0, 1.0e-9);
+    const std::string bucketed = fromReportData + " AND " + timeExpression + " BETWEEN ? AND ?"
+                                 " GROUP BY CAST((" + timeExpression + " - ?) * ? / ? AS INTEGER) ORDER BY MIN(Time.TimeIndex)";
+
+    boost::optional<std::vector<double>> x = sqlFile->execAndReturnVectorOfDouble("SELECT MIN(" + timeExpression + ")" + bucketed,
+      index, runPeriod, runPeriod, result.x0, result.x1, result.x0, result.buckets, span);
+    boost::optional<std::vector<double>> minValues = sqlFile->execAndReturnVectorOfDouble("SELECT MIN(ReportData.Value)" + bucketed,
+      index, runPeriod, runPeriod, result.x0, result.x1, result.x0, result.buckets, span);
+    boost::optional<std::vector<double>> maxValues = sqlFile->execAndReturnVectorOfDouble("SELECT MAX(ReportData.Value)" + bucketed,
+      index, runPeriod, runPeriod, result.x0, result.x1, result.x0, result.buckets, span);
+
+    if (x && minValues && maxValues && (x->size() == minValues->size()) && (x->size() == maxValues->size())){
+      result.x = *x;
+      result.minValues = *minValues;
+      result.maxValues = *maxValues;
+    }
+  } catch (const std::exception&) {
+    result.x.clear();
+    result.minValues.clear();
+    result.maxValues.clear();
+  }
+
+  return result;
+}
+
+TimeSeriesChart::TimeSeriesChart(QWidget * parent)
+  : QWidget(parent),
+    m_start(0.0),
+    m_end(0.0),
+    m_viewStart(0.0),
+    m_viewEnd(0.0)
+{
+  setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Expanding);
+  setMinimumHeight(200);
+}
+
+void TimeSeriesChart::clear()
+{
+  m_series.clear();
+  m_start = 0.0;
+  m_end = 0.0;
+  m_viewStart = 0.0;
+  m_viewEnd = 0.0;
+  update();
+}
+
+bool TimeSeriesChart::hasSeries(int dictionaryIndex) const
+{
+  return std::any_of(m_series.begin(), m_series.end(), [dictionaryIndex](const Series& series){
+    return series.variable.dictionaryIndex == dictionaryIndex;
+  });
+}
+
+void TimeSeriesChart::addSeries(const TimeSeriesVariable& variable, const TimeSeriesSamples& overview)
+{
+  if (hasSeries(variable.dictionaryIndex) || overview.x.empty()){
+    return;
+  }
+
+  Series series;
+  series.variable = variable;
+  series.color = seriesColors[m_series.size() % seriesColors.size()];
+  series.overview = overview;
+
+  if (m_series.empty()){
+    m_start = overview.x0;
+    m_end = overview.x1;
+    m_viewStart = m_start;
+    m_viewEnd = m_end;
+  } else{
+    m_start = std::min(m_start, overview.x0);
+    m_end = std::max(m_end, overview.x1);
+  }
+
+  m_series.push_back(series);
+
+  update();
+  emit viewChanged();
+}
+
+void TimeSeriesChart::setWindowSamples(const TimeSeriesSamples& samples)
+{
+  for (auto& series : m_series){
+    if (series.variable.dictionaryIndex == samples.dictionaryIndex){
+      series.window = samples;
+      update();
+      return;
+    }
+  }
+}
+
+std::vector<TimeSeriesVariable> TimeSeriesChart::seriesNeedingDetail() const
+{
+  std::vector<TimeSeriesVariable> result;
+
+  int width = plotWidth();
+  if ((width <= 0) || (m_viewEnd <= m_viewStart)){
+    return result;
+  }
+
+  // hours per pixel column on screen
+  double required = (m_viewEnd - m_viewStart) / width;
+
+  for (const auto& series : m_series){
+    const TimeSeriesSamples& samples = visibleSamples(series);
+    if (samples.buckets <= 0){
+      continue;
+    }
+    double resolution = (samples.x1 - samples.x0) / samples.buckets;
+    if (resolution > required){
+      result.push_back(series.variable);
+    }
+  }
+
+  return result;
+}
+
+double TimeSeriesChart::viewStart() const
+{
+  return m_viewStart;
+}
+
+double TimeSeriesChart::viewEnd() const
+{
+  return m_viewEnd;
+}
+
+int TimeSeriesChart::plotWidth() const
+{
+  return plotRect().width();
+}
+
+QRect TimeSeriesChart::plotRect() const
+{
+  // legend above, value labels on the left, time labels below
+  int legendHeight = 16 * static_cast<int>(m_series.size());
+  return QRect(70, 10 + legendHeight, std::max(width() - 80, 1), std::max(height() - legendHeight - 40, 1));
+}
+
+const TimeSeriesSamples& TimeSeriesChart::visibleSamples(const Series& series) const
+{
+  const TimeSeriesSamples& window = series.window;
+  if ((window.buckets > 0) && (window.x0 <= m_viewStart) && (window.x1 >= m_viewEnd)){
+    double windowResolution = (window.x1 - window.x0) / window.buckets;
+    double overviewResolution = (series.overview.x1 - series.overview.x0) / std::max(series.overview.buckets, 1);
+    if (windowResolution < overviewResolution){
+      return window;
+    }
+  }
+  return series.overview;
+}
+
+void TimeSeriesChart::setView(double start, double end)
+{
+  double fullSpan = m_end - m_start;
+  if (fullSpan <= 0.0){
+    return;
+  }
+
+  // no closer than a few minutes, no further than the whole run
+  double span = std::min(std::max(end - start, 0.1), fullSpan);
+  start = std::min(std::max(start, m_start), m_end - span);
+
+  if ((start != m_viewStart) || (start + span != m_viewEnd)){
+    m_viewStart = start;
+    m_viewEnd = start + span;
+    update();
+    emit viewChanged();
+  }
+}
+
+void TimeSeriesChart::paintEvent(QPaintEvent * event)
+{
+  QPainter painter(this);
+  painter.fillRect(rect(), Qt::white);
+
+  QRect plot = plotRect();
+  painter.setPen(QColor(200, 200, 200));
+  painter.drawRect(plot);
+
+  if (m_series.empty() || (m_viewEnd <= m_viewStart)){
+    painter.setPen(Qt::gray);
+    painter.drawText(plot, Qt::AlignCenter, "Add a variable to plot it");
+    return;
+  }
+
+  int width = plot.width();
+  double viewSpan = m_viewEnd - m_viewStart;
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+
+  // min and max of each series in each pixel column, whatever the resolution of the samples
+  std::vector<std::vector<std::pair<double, double>>> columns(m_series.size(), std::vector<std::pair<double, double>>(width, std::make_pair(nan, nan)));
+  double yMin = std::numeric_limits<double>::max();
+  double yMax = std::numeric_limits<double>::lowest();
+  for (size_t s = 0; s < m_series.size(); ++s){
+    const TimeSeriesSamples& samples = visibleSamples(m_series[s]);
+    for (size_t i = 0; i < samples.x.size(); ++i){
+      double x = samples.x[i];
+      if ((x < m_viewStart) || (x > m_viewEnd)){
+        continue;
+      }
+      int column = std::min(width - 1, static_cast<int>((x - m_viewStart) / viewSpan * width));
+      std::pair<double, double>& bucket = columns[s][column];
+      if (std::isnan(bucket.first)){
+        bucket = std::make_pair(samples.minValues[i], samples.maxValues[i]);
+      } else{
+        bucket.first = std::min(bucket.first, samples.minValues[i]);
+        bucket.second = std::max(bucket.second, samples.maxValues[i]);
+      }
+      yMin = std::min(yMin, samples.minValues[i]);
+      yMax = std::max(yMax, samples.maxValues[i]);
+    }
+  }
+
+  if (yMin > yMax){
+    yMin = 0.0;
+    yMax = 1.0;
+  } else if (yMax - yMin < 1.0e-12){
+    yMin -= 0.5;
+    yMax += 0.5;
+  } else{
+    double pad = 0.05 * (yMax - yMin);
+    yMin -= pad;
+    yMax += pad;
+  }
+
+  auto toY = [&plot, yMin, yMax](double value) {
+    return plot.bottom() - (value - yMin) / (yMax - yMin) * plot.height();
+  };
+
+  // value labels
+  painter.setPen(Qt::black);
+  for (int i = 0; i <= 4; ++i){
+    double value = yMin + i * (yMax - yMin) / 4.0;
+    double y = toY(value);
+    painter.setPen(QColor(230, 230, 230));
+    painter.drawLine(QPointF(plot.left(), y), QPointF(plot.right(), y));
+    painter.setPen(Qt::black);
+    painter.drawText(QRectF(0, y - 8, plot.left() - 6, 16), Qt::AlignRight | Qt::AlignVCenter, QLocale().toString(value, 'g', 4));
+  }
+
+  // time labels, about ten of them at a round step
+  double step = 24.0 * 30.0;
+  for (double candidate : {1.0, 2.0, 3.0, 6.0, 12.0, 24.0, 48.0, 24.0 * 7.0, 24.0 * 14.0, 24.0 * 30.0}){
+    if (viewSpan / candidate <= 10.0){
+      step = candidate;
+      break;
+    }
+  }
+  for (double t = std::ceil(m_viewStart / step) * step; t <= m_viewEnd; t += step){
+    double x = plot.left() + (t - m_viewStart) / viewSpan * width;
+    painter.setPen(QColor(230, 230, 230));
+    painter.drawLine(QPointF(x, plot.top()), QPointF(x, plot.bottom()));
+    painter.setPen(Qt::black);
+    painter.drawText(QRectF(x - 60, plot.bottom() + 4, 120, 16), Qt::AlignHCenter | Qt::AlignTop, timeLabel(t, step));
+  }
+
+  // envelopes
+  painter.setClipRect(plot);
+  painter.setRenderHint(QPainter::Antialiasing, false);
+  for (size_t s = 0; s < m_series.size(); ++s){
+    QPolygonF line;
+    for (int c = 0; c < width; ++c){
+      const std::pair<double, double>& bucket = columns[s][c];
+      if (!std::isnan(bucket.first)){
+        double x = plot.left() + c + 0.5;
+        line << QPointF(x, toY(bucket.first)) << QPointF(x, toY(bucket.second));
+      }
+    }
+    painter.setPen(QPen(m_series[s].color, 1));
+    painter.drawPolyline(line);
+  }
+  painter.setClipping(false);
+
+  // legend
+  for (size_t s = 0; s < m_series.size(); ++s){
+    int y = 4 + 16 * static_cast<int>(s);
+    painter.fillRect(QRect(plot.left(), y + 4, 10, 10), m_series[s].color);
+    painter.setPen(Qt::black);
+    painter.drawText(QRect(plot.left() + 16, y, plot.width() - 16, 16), Qt::AlignLeft | Qt::AlignVCenter, seriesLabel(m_series[s].variable));
+  }
+}
+
+void TimeSeriesChart::resizeEvent(QResizeEvent * event)
+{
+  QWidget::resizeEvent(event);
+  emit viewChanged();
+}
+
+void TimeSeriesChart::wheelEvent(QWheelEvent * event)
+{
+  QRect plot = plotRect();
+  double span = m_viewEnd - m_viewStart;
+  if (m_series.empty() || (span <= 0.0) || (event->angleDelta().y() == 0)){
+    event->ignore();
+    return;
+  }
+
+  // zoom around the time under the cursor
+  double fraction = std::min(std::max((event->pos().x() - plot.left()) / static_cast<double>(plot.width()), 0.0), 1.0);
+  double anchor = m_viewStart + fraction * span;
+  double newSpan = span * ((event->angleDelta().y() > 0) ? 0.8 : 1.25);
+  setView(anchor - fraction * newSpan, anchor + (1.0 - fraction) * newSpan);
+
+  event->accept();
+}
+
+void TimeSeriesChart::mousePressEvent(QMouseEvent * event)
+{
+  if (event->button() == Qt::LeftButton){
+    m_dragX = event->pos().x();
+    event->accept();
+  } else{
+    QWidget::mousePressEvent(event);
+  }
+}
+
+void TimeSeriesChart::mouseMoveEvent(QMouseEvent * event)
+{
+  if (m_dragX){
+    double span = m_viewEnd - m_viewStart;
+    double shift = -(event->pos().x() - *m_dragX) * span / plotRect().width();
+    m_dragX = event->pos().x();
+    setView(m_viewStart + shift, m_viewEnd + shift);
+    event->accept();
+  } else{
+    QWidget::mouseMoveEvent(event);
+  }
+}
+
+void TimeSeriesChart::mouseReleaseEvent(QMouseEvent * event)
+{
+  m_dragX.reset();
+  QWidget::mouseReleaseEvent(event);
+}
+
+void TimeSeriesChart::mouseDoubleClickEvent(QMouseEvent * event)
+{
+  setView(m_start, m_end);
+  event->accept();
+}
+
+ResultsTimeSeriesView::ResultsTimeSeriesView(QWidget * parent)
+  : QWidget(parent),
+    m_dictionaryRequested(false),
+    m_fetchTimer(new QTimer(this)),
+    m_variableComboBox(new QComboBox()),
+    m_addBtn(new QPushButton("Add")),
+    m_clearBtn(new QPushButton("Clear")),
+    m_statusLabel(new QLabel()),
+    m_chart(new TimeSeriesChart())
+{
+  auto mainLayout = new QVBoxLayout();
+  mainLayout->setContentsMargins(0, 0, 0, 0);
+  setLayout(mainLayout);
+
+  auto hLayout = new QHBoxLayout();
+  auto label = new QLabel("Variable: ");
+  label->setObjectName("H2");
+  hLayout->addWidget(label);
+  m_variableComboBox->setSizeAdjustPolicy(QComboBox::AdjustToContents);
+  hLayout->addWidget(m_variableComboBox);
+  hLayout->addWidget(m_addBtn);
+  hLayout->addWidget(m_clearBtn);
+  hLayout->addStretch();
+  hLayout->addWidget(m_statusLabel);
+  mainLayout->addLayout(hLayout);
+
+  m_chart->setToolTip("Scroll to zoom, drag to pan, double click to show the whole run");
+  mainLayout->addWidget(m_chart);
+
+  m_fetchTimer->setSingleShot(true);
+  m_fetchTimer->setInterval(FETCH_DELAY_MSEC);
+
+  connect(m_addBtn, &QPushButton::clicked, this, &ResultsTimeSeriesView::onAddClicked);
+  connect(m_clearBtn, &QPushButton::clicked, this, &ResultsTimeSeriesView::onClearClicked);
+  connect(m_chart, &TimeSeriesChart::viewChanged, this, &ResultsTimeSeriesView::onChartViewChanged);
+  connect(m_fetchTimer, &QTimer::timeout, this, &ResultsTimeSeriesView::onFetchTimeout);
+  connect(&m_dictionaryWatcher, &QFutureWatcher<TimeSeriesDictionary>::finished, this, &ResultsTimeSeriesView::onDictionaryFinished);
+  connect(&m_queryWatcher, &QFutureWatcher<TimeSeriesSamples>::finished, this, &ResultsTimeSeriesView::onQueryFinished);
+
+  m_addBtn->setEnabled(false);
+}
+
+ResultsTimeSeriesView::~ResultsTimeSeriesView()
+{
+  m_dictionaryWatcher.waitForFinished();
+  m_queryWatcher.waitForFinished();
+}
+
+void ResultsTimeSeriesView::setSqlFile(const openstudio::path& sqlFile)
+{
+  // every run rewrites the same run/eplusout.sql, the key catches a regenerated file
+  std::string sqlFileKey = resultsSummaryKey(sqlFile);
+  if (sqlFile == m_sqlFile && sqlFileKey == m_sqlFileKey){
+    return;
+  }
+
+  m_sqlFile = sqlFile;
+  m_sqlFileKey = sqlFileKey;
+  m_dictionaryRequested = false;
+  m_dictionary = TimeSeriesDictionary();
+  m_pendingQueries.clear();
+
+  m_chart->clear();
+  m_variableComboBox->clear();
+  m_addBtn->setEnabled(false);
+  m_statusLabel->clear();
+
+  // the variables are only read once the view is shown
+  if (isVisible()){
+    loadDictionary();
+  }
+}
+
+void ResultsTimeSeriesView::showEvent(QShowEvent * event)
+{
+  QWidget::showEvent(event);
+  loadDictionary();
+}
+
+void ResultsTimeSeriesView::loadDictionary()
+{
+  if (m_dictionaryRequested){
+    return;
+  }
+
+  if (m_sqlFile.empty() || !openstudio::filesystem::exists(m_sqlFile)){
+    m_statusLabel->setText("No simulation results");
+    return;
+  }
+
+  m_dictionaryRequested = true;
+  m_statusLabel->setText("Reading variables...");
+
+  // a running request for another file is redone when it finishes
+  if (!m_dictionaryWatcher.isRunning()){
+    m_runningDictionaryKey = m_sqlFileKey;
+    m_dictionaryWatcher.setFuture(QtConcurrent::run(queryTimeSeriesDictionary, m_sqlFile));
+  }
+}
+
+void ResultsTimeSeriesView::onDictionaryFinished()
+{
+  TimeSeriesDictionary dictionary = m_dictionaryWatcher.result();
+  if ((dictionary.sqlFilePath != m_sqlFile) || (m_runningDictionaryKey != m_sqlFileKey)){
+    if (m_dictionaryRequested){
+      m_dictionaryRequested = false;
+      loadDictionary();
+    }
+    return;
+  }
+
+  m_dictionary = dictionary;
+  m_statusLabel->setText(m_dictionary.error);
+
+  m_variableComboBox->clear();
+  for (size_t i = 0; i < m_dictionary.variables.size(); ++i){
+    const TimeSeriesVariable& variable = m_dictionary.variables[i];
+    m_variableComboBox->addItem(seriesLabel(variable) + QString(" (") + variable.frequency + QString(")"), static_cast<int>(i));
+  }
+  m_addBtn->setEnabled(m_dictionary.sqlFile && !m_dictionary.variables.empty());
+}
+
+void ResultsTimeSeriesView::onAddClicked()
+{
+  int i = m_variableComboBox->currentData().toInt();
+  if ((i < 0) || (i >= static_cast<int>(m_dictionary.variables.size()))){
+    return;
+  }
+
+  const TimeSeriesVariable& variable = m_dictionary.variables[i];
+  if (m_chart->hasSeries(variable.dictionaryIndex)){
+    return;
+  }
+
+  TimeSeriesQuery query;
+  query.variable = variable;
+  query.overview = true;
+  query.buckets = OVERVIEW_BUCKETS;
+  queueQuery(query);
+}
+
+void ResultsTimeSeriesView::onClearClicked()
+{
+  m_pendingQueries.clear();
+  m_chart->clear();
+}
+
+void ResultsTimeSeriesView::onChartViewChanged()
+{
+  m_fetchTimer->start();
+}
+
+void ResultsTimeSeriesView::onFetchTimeout()
+{
+  // fetch a margin on both sides so small pans stay at full resolution
+  double span = m_chart->viewEnd() - m_chart->viewStart();
+  for (const auto& variable : m_chart->seriesNeedingDetail()){
+    TimeSeriesQuery query;
+    query.variable = variable;
+    query.x0 = m_chart->viewStart() - span / 2.0;
+    query.x1 = m_chart->viewEnd() + span / 2.0;
+    query.buckets = 2 * m_chart->plotWidth();
+    queueQuery(query);
+  }
+}
+
+void ResultsTimeSeriesView::queueQuery(const TimeSeriesQuery& query)
+{
+  if (!query.overview){
+    m_pendingQueries.erase(std::remove_if(m_pendingQueries.begin(), m_pendingQueries.end(), [&query](const TimeSeriesQuery& pending){
+      return !pending.overview && (pending.variable.dictionaryIndex == query.variable.dictionaryIndex);
+    }), m_pendingQueries.end());
+  }
+
+  m_pendingQueries.push_back(query);
+  startNextQuery();
+}
+
+void ResultsTimeSeriesView::startNextQuery()
+{
+  if (m_queryWatcher.isRunning() || m_pendingQueries.empty() || !m_dictionary.sqlFile){
+    return;
+  }
+
+  m_runningQuery = m_pendingQueries.front();
+  m_pendingQueries.pop_front();
+  m_runningSqlFile = m_dictionary.sqlFile;
+
+  m_queryWatcher.setFuture(QtConcurrent::run(queryTimeSeries, m_runningSqlFile, m_dictionary.runPeriod, m_runningQuery));
+}
+
+void ResultsTimeSeriesView::onQueryFinished()
+{
+  TimeSeriesSamples samples = m_queryWatcher.result();
+
+  // results of a file that has been replaced since
+  if (m_runningSqlFile == m_dictionary.sqlFile){
+    if (m_runningQuery.overview){
+      m_chart->addSeries(m_runningQuery.variable, samples);
+    } else{
+      m_chart->setWindowSamples(samples);
+    }
+  }
+  m_runningSqlFile.reset();
+
+  startNextQuery();
+}
+
+} // openstudio
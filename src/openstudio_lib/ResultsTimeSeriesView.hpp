@@ -0,0 +1,221 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef OPENSTUDIO_RESULTSTIMESERIESVIEW_HPP
+#define OPENSTUDIO_RESULTSTIMESERIESVIEW_HPP
+
+#include <openstudio/utilities/core/Logger.hpp>
+#include <openstudio/utilities/core/Path.hpp>
+
+#include <QWidget>
+#include <QFutureWatcher>
+
+#include <boost/optional.hpp>
+
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+class QComboBox;
+class QLabel;
+class QPushButton;
+class QTimer;
+
+namespace openstudio {
+
+class SqlFile;
+
+// an output variable or meter in the ReportDataDictionary
+struct TimeSeriesVariable
+{
+  int dictionaryIndex = -1;
+  QString keyValue;
+  QString name;
+  QString frequency;
+  QString units;
+};
+
+// values of one variable decimated into buckets of the time range [x0, x1], x is in hours from the start of the run
+// period, a bucket holding a single report is at full resolution
+struct TimeSeriesSamples
+{
+  int dictionaryIndex = -1;
+  double x0 = 0.0;
+  double x1 = 0.0;
+  int buckets = 0;
+  std::vector<double> x;
+  std::vector<double> minValues;
+  std::vector<double> maxValues;
+};
+
+// what a connection to eplusout.sql needs to answer time series queries
+struct TimeSeriesDictionary
+{
+  openstudio::path sqlFilePath;
+  // an indexed temporary copy of sqlFilePath, deleted with the last reference
+  std::shared_ptr<SqlFile> sqlFile;
+  int runPeriod = -1;
+  std::vector<TimeSeriesVariable> variables;
+  QString error;
+};
+
+struct TimeSeriesQuery
+{
+  TimeSeriesVariable variable;
+  // the whole run period when overview is set
+  bool overview = false;
+  double x0 = 0.0;
+  double x1 = 0.0;
+  int buckets = 0;
+};
+
+// opens sqlFile and lists its variables, safe to call from a worker thread
+TimeSeriesDictionary queryTimeSeriesDictionary(const openstudio::path& sqlFile);
+
+// min and max per bucket computed by SQLite, safe to call from a worker thread as long as no other query uses sqlFile
+TimeSeriesSamples queryTimeSeries(std::shared_ptr<SqlFile> sqlFile, int runPeriod, const TimeSeriesQuery& query);
+
+// plots min/max envelopes of the samples per pixel column, zooms with the wheel, pans by dragging
+class TimeSeriesChart : public QWidget
+{
+  Q_OBJECT;
+
+  public:
+    TimeSeriesChart(QWidget * parent = nullptr);
+    virtual ~TimeSeriesChart() {}
+
+    void clear();
+
+    bool hasSeries(int dictionaryIndex) const;
+
+    void addSeries(const TimeSeriesVariable& variable, const TimeSeriesSamples& overview);
+
+    // samples of part of the run at a higher resolution than the overview
+    void setWindowSamples(const TimeSeriesSamples& samples);
+
+    // series whose overview is too coarse for the current view
+    std::vector<TimeSeriesVariable> seriesNeedingDetail() const;
+
+    double viewStart() const;
+    double viewEnd() const;
+    int plotWidth() const;
+
+  signals:
+    void viewChanged();
+
+  protected:
+    void paintEvent(QPaintEvent * event) override;
+    void resizeEvent(QResizeEvent * event) override;
+    void wheelEvent(QWheelEvent * event) override;
+    void mousePressEvent(QMouseEvent * event) override;
+    void mouseMoveEvent(QMouseEvent * event) override;
+    void mouseReleaseEvent(QMouseEvent * event) override;
+    void mouseDoubleClickEvent(QMouseEvent * event) override;
+
+  private:
+    struct Series
+    {
+      TimeSeriesVariable variable;
+      QColor color;
+      TimeSeriesSamples overview;
+      TimeSeriesSamples window;
+    };
+
+    QRect plotRect() const;
+
+    const TimeSeriesSamples& visibleSamples(const Series& series) const;
+
+    void setView(double start, double end);
+
+    std::vector<Series> m_series;
+
+    // whole run period and the part of it on screen
+    double m_start;
+    double m_end;
+    double m_viewStart;
+    double m_viewEnd;
+
+    boost::optional<int> m_dragX;
+};
+
+// time series of the output variables in eplusout.sql, queried on a worker thread as the view changes
+class ResultsTimeSeriesView : public QWidget
+{
+  Q_OBJECT;
+
+  public:
+    ResultsTimeSeriesView(QWidget * parent = nullptr);
+    virtual ~ResultsTimeSeriesView();
+
+    void setSqlFile(const openstudio::path& sqlFile);
+
+  protected:
+    void showEvent(QShowEvent * event) override;
+
+  private slots:
+    void onDictionaryFinished();
+    void onAddClicked();
+    void onClearClicked();
+    void onChartViewChanged();
+    void onFetchTimeout();
+    void onQueryFinished();
+
+  private:
+    REGISTER_LOGGER("openstudio::ResultsTimeSeriesView");
+
+    void loadDictionary();
+    void queueQuery(const TimeSeriesQuery& query);
+    void startNextQuery();
+
+    // path, size and modification time of the results file shown and of the one the running dictionary reads
+    openstudio::path m_sqlFile;
+    std::string m_sqlFileKey;
+    std::string m_runningDictionaryKey;
+    bool m_dictionaryRequested;
+    TimeSeriesDictionary m_dictionary;
+    QFutureWatcher<TimeSeriesDictionary> m_dictionaryWatcher;
+
+    // one query at a time shares the connection, queued window queries are replaced by newer ones
+    std::deque<TimeSeriesQuery> m_pendingQueries;
+    TimeSeriesQuery m_runningQuery;
+    std::shared_ptr<SqlFile> m_runningSqlFile;
+    QFutureWatcher<TimeSeriesSamples> m_queryWatcher;
+    QTimer * m_fetchTimer;
+
+    QComboBox * m_variableComboBox;
+    QPushButton * m_addBtn;
+    QPushButton * m_clearBtn;
+    QLabel * m_statusLabel;
+    TimeSeriesChart * m_chart;
+};
+
+} // openstudio
+
+#endif // OPENSTUDIO_RESULTSTIMESERIESVIEW_HPP
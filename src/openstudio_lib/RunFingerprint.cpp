@@ -0,0 +1,161 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "RunFingerprint.hpp"
+
+#include "../model_editor/Utilities.hpp"
+
+#include <openstudio/OpenStudio.hxx>
+#include <openstudio/utilities/bcl/BCLMeasure.hpp>
+#include <openstudio/utilities/core/ApplicationPathHelpers.hpp>
+#include <openstudio/utilities/data/Variant.hpp>
+#include <openstudio/utilities/filetypes/WorkflowStep.hpp>
+
+#include <QCryptographicHash>
+#include <QFile>
+#include <QJsonDocument>
+#include <QJsonObject>
+
+namespace openstudio {
+
+static void addFileToHash(QCryptographicHash & hash, const boost::optional<openstudio::path> & filePath)
+{
+  if (!filePath){
+    hash.addData("<none>");
+    return;
+  }
+
+  hash.addData(toQString(*filePath).toUtf8());
+
+  QFile file(toQString(*filePath));
+  if (file.open(QIODevice::ReadOnly)){
+    hash.addData(&file);
+  }
+}
+
+static void addMeasureStepsToHash(QCryptographicHash & hash, const WorkflowJSON & workflow, MeasureType measureType)
+{
+  for (const auto& step : workflow.getMeasureSteps(measureType)){
+    hash.addData(QByteArray::fromStdString(step.measureDirName()));
+
+    // the version id only changes when the measure is saved by an editor, checksums of the files on disk catch any edit
+    boost::optional<BCLMeasure> bclMeasure = workflow.getBCLMeasure(step);
+    if (bclMeasure){
+      bclMeasure->checkForUpdatesFiles();
+      for (const auto& file : bclMeasure->files()){
+        hash.addData(QByteArray::fromStdString(file.fileName()));
+        hash.addData("=");
+        hash.addData(QByteArray::fromStdString(file.checksum()));
+        hash.addData(";");
+      }
+    }
+
+    // arguments are ordered by name
+    for (const auto& argument : step.arguments()){
+      hash.addData(QByteArray::fromStdString(argument.first));
+      hash.addData("=");
+      hash.addData(QByteArray::fromStdString(argument.second.valueAsString()));
+      hash.addData(";");
+    }
+  }
+}
+
+RunFingerprint::RunFingerprint(const WorkflowJSON & workflow)
+{
+  QCryptographicHash simulationHash(QCryptographicHash::Sha1);
+
+  // a new version of OpenStudio or EnergyPlus changes the results
+  simulationHash.addData(QByteArray::fromStdString(openStudioLongVersion()));
+  simulationHash.addData(toQString(getEnergyPlusExecutable()).toUtf8());
+
+  boost::optional<openstudio::path> seedFile = workflow.seedFile();
+  addFileToHash(simulationHash, seedFile ? workflow.findFile(*seedFile) : boost::none);
+
+  boost::optional<openstudio::path> weatherFile = workflow.weatherFile();
+  addFileToHash(simulationHash, weatherFile ? workflow.findFile(*weatherFile) : boost::none);
+
+  addMeasureStepsToHash(simulationHash, workflow, MeasureType::ModelMeasure);
+  addMeasureStepsToHash(simulationHash, workflow, MeasureType::EnergyPlusMeasure);
+
+  m_simulationHash = simulationHash.result().toHex();
+
+  QCryptographicHash reportingHash(QCryptographicHash::Sha1);
+  addMeasureStepsToHash(reportingHash, workflow, MeasureType::ReportingMeasure);
+
+  m_reportingHash = reportingHash.result().toHex();
+}
+
+RunFingerprint::RunFingerprint(const QByteArray & simulationHash, const QByteArray & reportingHash)
+  : m_simulationHash(simulationHash),
+    m_reportingHash(reportingHash)
+{
+}
+
+boost::optional<RunFingerprint> RunFingerprint::load(const openstudio::path & fingerprintPath)
+{
+  QFile file(toQString(fingerprintPath));
+  if (!file.open(QIODevice::ReadOnly)){
+    return boost::none;
+  }
+
+  QJsonObject object = QJsonDocument::fromJson(file.readAll()).object();
+  if (!object.contains("simulation") || !object.contains("reporting")){
+    LOG(Warn, "Ignoring invalid run fingerprint '" << toString(fingerprintPath) << "'");
+    return boost::none;
+  }
+
+  return RunFingerprint(object.value("simulation").toString().toUtf8(), object.value("reporting").toString().toUtf8());
+}
+
+bool RunFingerprint::save(const openstudio::path & fingerprintPath) const
+{
+  QJsonObject object;
+  object.insert("simulation", QString::fromUtf8(m_simulationHash));
+  object.insert("reporting", QString::fromUtf8(m_reportingHash));
+
+  QFile file(toQString(fingerprintPath));
+  if (!file.open(QIODevice::WriteOnly)){
+    return false;
+  }
+
+  file.write(QJsonDocument(object).toJson());
+  return true;
+}
+
+const QByteArray & RunFingerprint::simulationHash() const
+{
+  return m_simulationHash;
+}
+
+const QByteArray & RunFingerprint::reportingHash() const
+{
+  return m_reportingHash;
+}
+
+} // openstudio
@@ -0,0 +1,76 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef OPENSTUDIO_RUNFINGERPRINT_HPP
+#define OPENSTUDIO_RUNFINGERPRINT_HPP
+
+#include <openstudio/utilities/core/Logger.hpp>
+#include <openstudio/utilities/core/Path.hpp>
+#include <openstudio/utilities/filetypes/WorkflowJSON.hpp>
+
+#include <QByteArray>
+
+namespace openstudio {
+
+// Hashes of the inputs to each part of a workflow run. If the simulation inputs (seed model, OpenStudio and
+// EnergyPlus measures with their files and arguments, weather file) and the reporting measures are unchanged since
+// the last successful run, its in.idf and eplusout.sql can be reused and only the reporting measures are run again.
+// Reporting measures are part of the check because their output requests are added to the simulation.
+class RunFingerprint
+{
+ public:
+
+  // computes the fingerprint of workflow as it would be run now
+  explicit RunFingerprint(const WorkflowJSON & workflow);
+
+  // loads a fingerprint saved by save, returns boost::none if there is none or it cannot be read
+  static boost::optional<RunFingerprint> load(const openstudio::path & fingerprintPath);
+
+  bool save(const openstudio::path & fingerprintPath) const;
+
+  // seed model, OpenStudio measures, translator, EnergyPlus measures and simulation
+  const QByteArray & simulationHash() const;
+
+  // reporting measures
+  const QByteArray & reportingHash() const;
+
+ private:
+
+  REGISTER_LOGGER("openstudio::RunFingerprint");
+
+  RunFingerprint(const QByteArray & simulationHash, const QByteArray & reportingHash);
+
+  QByteArray m_simulationHash;
+
+  QByteArray m_reportingHash;
+};
+
+} // openstudio
+
+#endif // OPENSTUDIO_RUNFINGERPRINT_HPP
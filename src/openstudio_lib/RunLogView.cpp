@@ -0,0 +1,471 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "RunLogView.hpp"
+
+#include "../model_editor/Utilities.hpp"
+
+#include <QBoxLayout>
+#include <QColor>
+#include <QComboBox>
+#include <QFileInfo>
+#include <QFontDatabase>
+#include <QLabel>
+#include <QListView>
+#include <QScrollBar>
+#include <QTimer>
+
+#include <algorithm>
+#include <cstring>
+
+namespace openstudio {
+
+// interval at which the log file is checked for new data while running
+static const int TAIL_LOG_MSEC = 1000;
+
+LogFileIndex::LogFileIndex(const QString & path)
+  : m_path(path),
+    m_file(path),
+    m_data(nullptr),
+    m_mappedSize(0),
+    m_indexedSize(0),
+    m_counts(Severity::Fatal + 1, 0)
+{
+}
+
+LogFileIndex::~LogFileIndex()
+{
+  release();
+}
+
+const QString & LogFileIndex::path() const
+{
+  return m_path;
+}
+
+void LogFileIndex::unmap()
+{
+  if (m_data){
+    m_file.unmap(m_data);
+    m_data = nullptr;
+  }
+  m_mappedSize = 0;
+}
+
+void LogFileIndex::clear()
+{
+  m_indexedSize = 0;
+  m_lineOffsets.clear();
+  m_severities.clear();
+  std::fill(m_counts.begin(), m_counts.end(), 0);
+}
+
+void LogFileIndex::release()
+{
+  unmap();
+  m_file.close();
+  clear();
+}
+
+bool LogFileIndex::refresh()
+{
+  bool result = true;
+
+  // the file is replaced on each run, reopen if it went away
+  QFileInfo info(m_path);
+  if (!info.exists()){
+    if (m_file.isOpen() || !m_lineOffsets.empty()){
+      release();
+      return false;
+    }
+    return true;
+  }
+
+  if (!m_file.isOpen()){
+    if (!m_file.open(QIODevice::ReadOnly)){
+      return true;
+    }
+  }
+
+  qint64 size = info.size();
+  if (size < m_indexedSize){
+    // truncated
+    unmap();
+    clear();
+    result = false;
+  }
+
+  if (size == 0 || size == m_mappedSize){
+    return result;
+  }
+
+  // remap the whole file, only the new part is scanned
+  unmap();
+  m_data = m_file.map(0, size);
+  if (!m_data){
+    LOG(Warn, "Could not map '" << toString(m_path) << "'");
+    return result;
+  }
+  m_mappedSize = size;
+
+  const char * data = reinterpret_cast<const char *>(m_data);
+  const char * begin = data + m_indexedSize;
+  const char * end = data + m_mappedSize;
+  Severity previous = m_severities.empty() ? Severity::Info : static_cast<Severity>(m_severities.back());
+
+  while (begin < end){
+    const char * newline = static_cast<const char *>(std::memchr(begin, '\n', end - begin));
+    if (!newline){
+      break;
+    }
+
+    Severity severity = parseSeverity(begin, newline, previous);
+    m_lineOffsets.push_back(begin - data);
+    m_severities.push_back(static_cast<unsigned char>(severity));
+    ++m_counts[severity];
+
+    previous = severity;
+    begin = newline + 1;
+  }
+
+  m_indexedSize = begin - data;
+
+  return result;
+}
+
+LogFileIndex::Severity LogFileIndex::parseSeverity(const char * begin, const char * end, Severity previous)
+{
+  // markers are at the start of the line after some indentation, e.g. "   ** Warning ** ..."
+  const char * markerBegin = begin;
+  while ((markerBegin < end) && (*markerBegin == ' ')){
+    ++markerBegin;
+  }
+
+  if ((end - markerBegin) < 13 || std::strncmp(markerBegin, "**", 2) != 0){
+    return Severity::Info;
+  }
+
+  QByteArray marker = QByteArray::fromRawData(markerBegin, 13).simplified();
+  if (marker == "** Warning **"){
+    return Severity::Warning;
+  } else if (marker == "** Severe **"){
+    return Severity::Severe;
+  } else if (marker == "** Fatal **"){
+    return Severity::Fatal;
+  } else if (marker == "** ~~~ **"){
+    return previous;
+  }
+
+  return Severity::Info;
+}
+
+int LogFileIndex::lineCount() const
+{
+  return static_cast<int>(m_lineOffsets.size());
+}
+
+QString LogFileIndex::line(int index) const
+{
+  if (!m_data || (index < 0) || (index >= lineCount())){
+    return QString();
+  }
+
+  qint64 begin = m_lineOffsets[index];
+  qint64 end = (index + 1 < lineCount()) ? m_lineOffsets[index + 1] : m_indexedSize;
+
+  // strip the line ending
+  const char * data = reinterpret_cast<const char *>(m_data);
+  while ((end > begin) && ((data[end - 1] == '\n') || (data[end - 1] == '\r'))){
+    --end;
+  }
+
+  return QString::fromUtf8(data + begin, static_cast<int>(end - begin));
+}
+
+LogFileIndex::Severity LogFileIndex::severity(int index) const
+{
+  return static_cast<Severity>(m_severities[index]);
+}
+
+int LogFileIndex::count(Severity severity) const
+{
+  return m_counts[severity];
+}
+
+LogFileModel::LogFileModel(QObject * parent)
+  : QAbstractListModel(parent),
+    m_minimumSeverity(LogFileIndex::Info),
+    m_scannedLines(0),
+    m_rowCount(0)
+{
+}
+
+void LogFileModel::setFile(const QString & path)
+{
+  beginResetModel();
+  m_index.reset(new LogFileIndex(path));
+  m_filteredLines.clear();
+  m_scannedLines = 0;
+  m_rowCount = 0;
+  endResetModel();
+
+  refresh();
+}
+
+LogFileIndex * LogFileModel::logFileIndex() const
+{
+  return m_index.get();
+}
+
+void LogFileModel::setMinimumSeverity(LogFileIndex::Severity severity)
+{
+  beginResetModel();
+  m_minimumSeverity = severity;
+  m_filteredLines.clear();
+  m_scannedLines = 0;
+  m_rowCount = 0;
+  endResetModel();
+
+  refresh();
+}
+
+void LogFileModel::release()
+{
+  if (m_index){
+    beginResetModel();
+    m_index->release();
+    m_filteredLines.clear();
+    m_scannedLines = 0;
+    m_rowCount = 0;
+    endResetModel();
+  }
+}
+
+void LogFileModel::refresh()
+{
+  if (!m_index){
+    return;
+  }
+
+  if (!m_index->refresh()){
+    // file was rewritten
+    beginResetModel();
+    m_filteredLines.clear();
+    m_scannedLines = 0;
+    m_rowCount = 0;
+    endResetModel();
+  }
+
+  int lineCount = m_index->lineCount();
+  int rowCount = lineCount;
+
+  if (m_minimumSeverity != LogFileIndex::Info){
+    // only lines added since the last refresh need to be filtered
+    std::vector<int> newLines;
+    for (int i = m_scannedLines; i < lineCount; ++i){
+      if (m_index->severity(i) >= m_minimumSeverity){
+        newLines.push_back(i);
+      }
+    }
+    m_filteredLines.insert(m_filteredLines.end(), newLines.begin(), newLines.end());
+    rowCount = static_cast<int>(m_filteredLines.size());
+  }
+  m_scannedLines = lineCount;
+
+  if (rowCount > m_rowCount){
+    beginInsertRows(QModelIndex(), m_rowCount, rowCount - 1);
+    m_rowCount = rowCount;
+    endInsertRows();
+  }
+}
+
+int LogFileModel::lineForRow(int row) const
+{
+  if (m_minimumSeverity == LogFileIndex::Info){
+    return row;
+  }
+  return m_filteredLines[row];
+}
+
+int LogFileModel::rowCount(const QModelIndex & parent) const
+{
+  if (parent.isValid()){
+    return 0;
+  }
+  return m_rowCount;
+}
+
+QVariant LogFileModel::data(const QModelIndex & index, int role) const
+{
+  if (!m_index || !index.isValid() || (index.row() >= m_rowCount)){
+    return QVariant();
+  }
+
+  int line = lineForRow(index.row());
+
+  if (role == Qt::DisplayRole){
+    return m_index->line(line);
+  } else if (role == Qt::ForegroundRole){
+    switch (m_index->severity(line)){
+      case LogFileIndex::Warning:
+        return QColor("#C47B06");
+      case LogFileIndex::Severe:
+      case LogFileIndex::Fatal:
+        return QColor(Qt::red);
+      default:
+        break;
+    }
+  }
+
+  return QVariant();
+}
+
+RunLogView::RunLogView(QWidget * parent)
+  : QWidget(parent)
+{
+  auto mainLayout = new QVBoxLayout();
+  mainLayout->setContentsMargins(0,0,0,0);
+  mainLayout->setSpacing(5);
+  setLayout(mainLayout);
+
+  auto hLayout = new QHBoxLayout();
+  hLayout->setSpacing(5);
+  mainLayout->addLayout(hLayout);
+
+  m_fileComboBox = new QComboBox();
+  m_fileComboBox->addItem("Standard Output", "stdout");
+  m_fileComboBox->addItem("Standard Error", "stderr");
+  m_fileComboBox->addItem("EnergyPlus Errors (eplusout.err)", "run/eplusout.err");
+  hLayout->addWidget(m_fileComboBox);
+
+  m_severityComboBox = new QComboBox();
+  m_severityComboBox->addItem("All Lines", LogFileIndex::Info);
+  m_severityComboBox->addItem("Warnings and Errors", LogFileIndex::Warning);
+  m_severityComboBox->addItem("Severe and Fatal Errors", LogFileIndex::Severe);
+  m_severityComboBox->addItem("Fatal Errors", LogFileIndex::Fatal);
+  hLayout->addWidget(m_severityComboBox);
+
+  m_countsLabel = new QLabel();
+  hLayout->addWidget(m_countsLabel);
+  hLayout->addStretch();
+
+  m_model = new LogFileModel(this);
+
+  m_listView = new QListView();
+  // rows are only created for what is visible
+  m_listView->setUniformItemSizes(true);
+  m_listView->setLayoutMode(QListView::Batched);
+  m_listView->setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
+  m_listView->setSelectionMode(QAbstractItemView::ExtendedSelection);
+  m_listView->setModel(m_model);
+  mainLayout->addWidget(m_listView);
+
+  m_tailTimer = new QTimer(this);
+  m_tailTimer->setInterval(TAIL_LOG_MSEC);
+  connect(m_tailTimer, &QTimer::timeout, this, &RunLogView::refresh);
+
+  connect(m_fileComboBox, static_cast<void (QComboBox::*)(int)>(&QComboBox::currentIndexChanged), this, &RunLogView::onFileChanged);
+  connect(m_severityComboBox, static_cast<void (QComboBox::*)(int)>(&QComboBox::currentIndexChanged), this, &RunLogView::onSeverityChanged);
+}
+
+void RunLogView::setRunDirectory(const openstudio::path & runDirectory)
+{
+  // keep the existing index, only pick up new data
+  if ((runDirectory == m_runDirectory) && m_model->logFileIndex()){
+    refresh();
+    return;
+  }
+
+  m_runDirectory = runDirectory;
+  onFileChanged(m_fileComboBox->currentIndex());
+}
+
+void RunLogView::startTailing()
+{
+  m_tailTimer->start();
+}
+
+void RunLogView::stopTailing()
+{
+  m_tailTimer->stop();
+  refresh();
+}
+
+void RunLogView::releaseFiles()
+{
+  m_model->release();
+  updateCounts();
+}
+
+void RunLogView::refresh()
+{
+  // follow the end of the file if the user has not scrolled away from it
+  QScrollBar * scrollBar = m_listView->verticalScrollBar();
+  bool atBottom = (scrollBar->value() == scrollBar->maximum());
+
+  m_model->refresh();
+  updateCounts();
+
+  if (atBottom && m_tailTimer->isActive()){
+    m_listView->scrollToBottom();
+  }
+}
+
+void RunLogView::onFileChanged(int index)
+{
+  if (m_runDirectory.empty()){
+    return;
+  }
+
+  openstudio::path filePath = m_runDirectory / toPath(m_fileComboBox->itemData(index).toString());
+  m_model->setFile(toQString(filePath));
+  updateCounts();
+}
+
+void RunLogView::onSeverityChanged(int index)
+{
+  m_model->setMinimumSeverity(static_cast<LogFileIndex::Severity>(m_severityComboBox->itemData(index).toInt()));
+}
+
+void RunLogView::updateCounts()
+{
+  LogFileIndex * index = m_model->logFileIndex();
+  if (!index){
+    m_countsLabel->clear();
+    return;
+  }
+
+  m_countsLabel->setText(QString("%1 lines, %2 warnings, %3 severe, %4 fatal")
+    .arg(index->lineCount())
+    .arg(index->count(LogFileIndex::Warning))
+    .arg(index->count(LogFileIndex::Severe))
+    .arg(index->count(LogFileIndex::Fatal)));
+}
+
+} // openstudio
@@ -0,0 +1,207 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef OPENSTUDIO_RUNLOGVIEW_HPP
+#define OPENSTUDIO_RUNLOGVIEW_HPP
+
+#include <openstudio/utilities/core/Logger.hpp>
+#include <openstudio/utilities/core/Path.hpp>
+
+#include <QAbstractListModel>
+#include <QFile>
+#include <QWidget>
+
+#include <memory>
+#include <vector>
+
+class QComboBox;
+class QLabel;
+class QListView;
+class QTimer;
+
+namespace openstudio {
+
+// Line index over a log file which may still be growing, the file is memory mapped and only data appended
+// since the last refresh is scanned. Lines are tagged with the EnergyPlus severity markers found in
+// eplusout.err, e.g. "** Severe  **", continuation lines ("**   ~~~   **") inherit the previous severity.
+class LogFileIndex
+{
+ public:
+
+  enum Severity { Info = 0, Warning = 1, Severe = 2, Fatal = 3 };
+
+  explicit LogFileIndex(const QString & path);
+
+  ~LogFileIndex();
+
+  const QString & path() const;
+
+  // maps and indexes any data appended since the last call, returns false if the file was truncated
+  // or replaced and the index had to be rebuilt from the start
+  bool refresh();
+
+  // unmaps and closes the file so it can be removed or rewritten, the next refresh starts over
+  void release();
+
+  // number of complete lines, a trailing line without newline is not counted until it is terminated
+  int lineCount() const;
+
+  QString line(int index) const;
+
+  Severity severity(int index) const;
+
+  int count(Severity severity) const;
+
+ private:
+
+  REGISTER_LOGGER("openstudio::LogFileIndex");
+
+  void unmap();
+
+  void clear();
+
+  static Severity parseSeverity(const char * begin, const char * end, Severity previous);
+
+  QString m_path;
+
+  QFile m_file;
+
+  uchar * m_data;
+
+  qint64 m_mappedSize;
+
+  // end of the last complete line
+  qint64 m_indexedSize;
+
+  std::vector<qint64> m_lineOffsets;
+
+  std::vector<unsigned char> m_severities;
+
+  std::vector<int> m_counts;
+};
+
+// List model over a LogFileIndex, optionally only showing lines at or above a minimum severity
+class LogFileModel : public QAbstractListModel
+{
+  Q_OBJECT
+
+ public:
+
+  explicit LogFileModel(QObject * parent = nullptr);
+
+  virtual ~LogFileModel() {}
+
+  void setFile(const QString & path);
+
+  LogFileIndex * logFileIndex() const;
+
+  void setMinimumSeverity(LogFileIndex::Severity severity);
+
+  // picks up data appended to the file
+  void refresh();
+
+  void release();
+
+  int rowCount(const QModelIndex & parent = QModelIndex()) const override;
+
+  QVariant data(const QModelIndex & index, int role = Qt::DisplayRole) const override;
+
+ private:
+
+  int lineForRow(int row) const;
+
+  std::unique_ptr<LogFileIndex> m_index;
+
+  LogFileIndex::Severity m_minimumSeverity;
+
+  // lines passing the filter, only used when filtering
+  std::vector<int> m_filteredLines;
+
+  // number of index lines already run through the filter
+  int m_scannedLines;
+
+  int m_rowCount;
+};
+
+// Live view of the run's stdout, stderr and eplusout.err
+class RunLogView : public QWidget
+{
+  Q_OBJECT
+
+ public:
+
+  RunLogView(QWidget * parent = nullptr);
+
+  virtual ~RunLogView() {}
+
+  // directory containing stdout, stderr and run/eplusout.err
+  void setRunDirectory(const openstudio::path & runDirectory);
+
+  // polls the current file for new data while the simulation runs
+  void startTailing();
+
+  void stopTailing();
+
+  // closes all files, call before the run removes them
+  void releaseFiles();
+
+ public slots:
+
+  void refresh();
+
+ private slots:
+
+  void onFileChanged(int index);
+
+  void onSeverityChanged(int index);
+
+ private:
+
+  REGISTER_LOGGER("openstudio::RunLogView");
+
+  void updateCounts();
+
+  openstudio::path m_runDirectory;
+
+  QComboBox * m_fileComboBox;
+
+  QComboBox * m_severityComboBox;
+
+  QLabel * m_countsLabel;
+
+  QListView * m_listView;
+
+  LogFileModel * m_model;
+
+  QTimer * m_tailTimer;
+};
+
+} // openstudio
+
+#endif // OPENSTUDIO_RUNLOGVIEW_HPP
@@ -0,0 +1,210 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "RunProgressChannel.hpp"
+
+#include <QTcpSocket>
+
+namespace openstudio {
+
+RunProgressChannel::RunProgressChannel(QObject * parent)
+  : QObject(parent),
+    m_state(State::stopped)
+{
+}
+
+const QHash<QString, RunProgressChannel::LineAction> & RunProgressChannel::lineActions()
+{
+  // keys are lower case, lines are matched case insensitively
+  static const QHash<QString, LineAction> actions = [](){
+    QHash<QString, LineAction> result;
+
+    auto addState = [&result](const QString & name, State state, const QString & text) {
+      result.insert("starting state " + name, LineAction{StartState, state, H1Message, text});
+      result.insert("returned from state " + name, LineAction{ReturnState, state, NormalMessage, QString()});
+    };
+
+    addState("initialization", State::initialization, "Initializing workflow.");
+    addState("os_measures", State::os_measures, "Processing OpenStudio Measures.");
+    addState("translator", State::translator, "Translating the OpenStudio Model to EnergyPlus.");
+    addState("ep_measures", State::ep_measures, "Processing EnergyPlus Measures.");
+    // no message for the preprocess state
+    addState("preprocess", State::preprocess, QString());
+    addState("simulation", State::simulation, "Starting Simulation.");
+    addState("reporting_measures", State::reporting_measures, "Processing Reporting Measures.");
+    addState("postprocess", State::postprocess, "Gathering Reports.");
+
+    result.insert("started", LineAction{NoAction, State::stopped, NormalMessage, QString()});
+    result.insert("failure", LineAction{Message, State::stopped, ErrorMessage, "Failed."});
+    result.insert("complete", LineAction{Message, State::stopped, H1Message, "Completed."});
+
+    return result;
+  }();
+
+  return actions;
+}
+
+void RunProgressChannel::reset()
+{
+  m_buffer.clear();
+  m_state = State::stopped;
+  m_stateStarted.fill(QDateTime());
+  m_stateReturned.fill(QDateTime());
+}
+
+void RunProgressChannel::setSocket(QTcpSocket * socket)
+{
+  if (m_socket){
+    disconnect(m_socket, nullptr, this, nullptr);
+  }
+
+  m_socket = socket;
+
+  if (m_socket){
+    connect(m_socket, &QTcpSocket::readyRead, this, &RunProgressChannel::onReadyRead);
+    connect(m_socket, &QTcpSocket::disconnected, this, &RunProgressChannel::flush);
+  }
+}
+
+void RunProgressChannel::onReadyRead()
+{
+  if (m_socket){
+    appendData(m_socket->readAll());
+  }
+}
+
+void RunProgressChannel::appendData(const QByteArray & data)
+{
+  m_buffer.append(data);
+
+  int begin = 0;
+  int end = m_buffer.indexOf('\n', begin);
+  while (end >= 0){
+    processLine(m_buffer.mid(begin, end - begin));
+    begin = end + 1;
+    end = m_buffer.indexOf('\n', begin);
+  }
+
+  // keep the partial line
+  m_buffer.remove(0, begin);
+}
+
+void RunProgressChannel::flush()
+{
+  if (!m_buffer.isEmpty()){
+    QByteArray line = m_buffer;
+    m_buffer.clear();
+    processLine(line);
+  }
+}
+
+void RunProgressChannel::processLine(const QByteArray & data)
+{
+  QString line = QString::fromUtf8(data);
+  if (line.endsWith('\r')){
+    line.chop(1);
+  }
+
+  QString trimmedLine = line.trimmed();
+  if (trimmedLine.isEmpty()){
+    return;
+  }
+
+  const QHash<QString, LineAction> & actions = lineActions();
+  auto it = actions.constFind(trimmedLine.toLower());
+  if (it != actions.constEnd()){
+    const LineAction & action = it.value();
+    switch (action.type){
+      case StartState:
+        m_state = action.state;
+        m_stateStarted[action.state] = QDateTime::currentDateTime();
+        if (!action.text.isEmpty()){
+          emit messageReceived(action.text, action.messageType);
+        }
+        emit stateChanged(m_state);
+        break;
+      case ReturnState:
+        m_stateReturned[action.state] = QDateTime::currentDateTime();
+        break;
+      case Message:
+        emit messageReceived(action.text, action.messageType);
+        break;
+      case NoAction:
+        break;
+    }
+  } else if (trimmedLine.startsWith("Applying", Qt::CaseInsensitive)) {
+    emit messageReceived(line, H2Message);
+  } else if (trimmedLine.startsWith("Applied", Qt::CaseInsensitive)) {
+    // no-op
+  } else {
+    emit messageReceived(line, NormalMessage);
+  }
+}
+
+RunProgressChannel::State RunProgressChannel::state() const
+{
+  return m_state;
+}
+
+QDateTime RunProgressChannel::stateStarted(State state) const
+{
+  return m_stateStarted[state];
+}
+
+QDateTime RunProgressChannel::stateReturned(State state) const
+{
+  return m_stateReturned[state];
+}
+
+qint64 RunProgressChannel::stateDurationMSecs(State state) const
+{
+  if (m_stateStarted[state].isValid() && m_stateReturned[state].isValid()){
+    return m_stateStarted[state].msecsTo(m_stateReturned[state]);
+  }
+  return -1;
+}
+
+QString RunProgressChannel::stateDisplayName(State state)
+{
+  switch (state){
+    case State::stopped: return "Stopped";
+    case State::initialization: return "Initialization";
+    case State::os_measures: return "OpenStudio Measures";
+    case State::translator: return "Translator";
+    case State::ep_measures: return "EnergyPlus Measures";
+    case State::preprocess: return "Preprocess";
+    case State::simulation: return "EnergyPlus";
+    case State::reporting_measures: return "Reporting Measures";
+    case State::postprocess: return "Postprocess";
+    case State::complete: return "Complete";
+  }
+  return QString();
+}
+
+} // openstudio
@@ -0,0 +1,132 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef OPENSTUDIO_RUNPROGRESSCHANNEL_HPP
+#define OPENSTUDIO_RUNPROGRESSCHANNEL_HPP
+
+#include <openstudio/utilities/core/Logger.hpp>
+
+#include <QByteArray>
+#include <QDateTime>
+#include <QHash>
+#include <QObject>
+#include <QPointer>
+#include <QString>
+
+#include <array>
+
+class QTcpSocket;
+
+namespace openstudio {
+
+// Parses the progress messages sent by the workflow gem over the run socket (see openstudio-workflow-gem
+// lib/openstudio/workflow/adapters/output/socket.rb). Data is framed into complete lines, partial lines are
+// kept until the rest arrives, and each line is dispatched through a lookup table.
+class RunProgressChannel : public QObject
+{
+  Q_OBJECT
+
+ public:
+
+  enum State { stopped = 0, initialization = 1, os_measures = 2, translator = 3, ep_measures = 4, preprocess = 5, simulation = 6, reporting_measures = 7, postprocess = 8, complete = 9 };
+
+  enum MessageType { NormalMessage = 0, H1Message = 1, H2Message = 2, ErrorMessage = 3 };
+
+  explicit RunProgressChannel(QObject * parent = nullptr);
+
+  virtual ~RunProgressChannel() {}
+
+  // clears state, timestamps and any buffered partial line
+  void reset();
+
+  // reads from socket as data arrives, the socket is not owned
+  void setSocket(QTcpSocket * socket);
+
+  // frames data into lines, a trailing partial line is buffered until the next call
+  void appendData(const QByteArray & data);
+
+  // processes any buffered partial line, call when the stream ends
+  void flush();
+
+  State state() const;
+
+  // time the workflow entered state, invalid if it has not
+  QDateTime stateStarted(State state) const;
+
+  // time the workflow returned from state, invalid if it has not
+  QDateTime stateReturned(State state) const;
+
+  // milliseconds spent in state, -1 if the state has not both started and returned
+  qint64 stateDurationMSecs(State state) const;
+
+  // human readable name of state, e.g. "EnergyPlus" for simulation
+  static QString stateDisplayName(State state);
+
+ signals:
+
+  void stateChanged(int state);
+
+  void messageReceived(const QString & text, int messageType);
+
+ private slots:
+
+  void onReadyRead();
+
+ private:
+
+  REGISTER_LOGGER("openstudio::RunProgressChannel");
+
+  enum ActionType { NoAction, StartState, ReturnState, Message };
+
+  struct LineAction
+  {
+    ActionType type;
+    State state;
+    MessageType messageType;
+    QString text;
+  };
+
+  static const QHash<QString, LineAction> & lineActions();
+
+  void processLine(const QByteArray & line);
+
+  QPointer<QTcpSocket> m_socket;
+
+  QByteArray m_buffer;
+
+  State m_state;
+
+  std::array<QDateTime, State::complete + 1> m_stateStarted;
+
+  std::array<QDateTime, State::complete + 1> m_stateReturned;
+};
+
+} // openstudio
+
+#endif // OPENSTUDIO_RUNPROGRESSCHANNEL_HPP
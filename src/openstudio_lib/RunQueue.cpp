@@ -0,0 +1,373 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "RunQueue.hpp"
+
+#include "../model_editor/Utilities.hpp"
+#include "../utilities/OpenStudioApplicationPathHelpers.hpp"
+
+#include <openstudio/utilities/core/Assert.hpp>
+#include <openstudio/utilities/core/PathHelpers.hpp>
+
+#include <QGridLayout>
+#include <QLabel>
+#include <QProgressBar>
+#include <QTcpServer>
+#include <QTcpSocket>
+#include <QThread>
+
+#include <algorithm>
+
+namespace openstudio {
+
+RunQueue::RunQueue(QObject * parent)
+  : QObject(parent),
+    m_maxConcurrentRuns(std::max(1, QThread::idealThreadCount())),
+    m_environment(QProcessEnvironment::systemEnvironment()),
+    m_canceled(false)
+{
+}
+
+RunQueue::~RunQueue()
+{
+  // the owner is going away too, it must not hear about the canceled jobs
+  blockSignals(true);
+  cancel();
+}
+
+int RunQueue::maxConcurrentRuns() const
+{
+  return m_maxConcurrentRuns;
+}
+
+void RunQueue::setMaxConcurrentRuns(int maxConcurrentRuns)
+{
+  m_maxConcurrentRuns = std::max(1, maxConcurrentRuns);
+  if (isRunning()){
+    startQueuedJobs();
+  }
+}
+
+void RunQueue::setProcessEnvironment(const QProcessEnvironment & environment)
+{
+  m_environment = environment;
+}
+
+int RunQueue::addJob(const QString & name, WorkflowJSON workflow, const openstudio::path & jobDirectory)
+{
+  // DLM: makeParentFolder only makes the parent folder, add '.' to force creation of the parent
+  bool test = makeParentFolder(jobDirectory / toPath("."), path(), true);
+  OS_ASSERT(test);
+
+  workflow.saveAs(jobDirectory / toPath("workflow.osw"));
+
+  Job job;
+  job.name = name;
+  job.directory = jobDirectory;
+  job.status = JobStatus::Queued;
+  job.process = nullptr;
+  job.server = nullptr;
+  job.socket = nullptr;
+  job.channel = new RunProgressChannel(this);
+  m_jobs.push_back(job);
+
+  int index = static_cast<int>(m_jobs.size()) - 1;
+  connect(job.channel, &RunProgressChannel::stateChanged, this, [this, index](int state) { emit jobStateChanged(index, state); });
+  connect(job.channel, &RunProgressChannel::messageReceived, this, [this, index](const QString & text, int messageType) { emit jobMessageReceived(index, text, messageType); });
+
+  return index;
+}
+
+void RunQueue::clear()
+{
+  OS_ASSERT(!isRunning());
+
+  for (auto & job : m_jobs){
+    delete job.process;
+    delete job.server;
+    delete job.channel;
+  }
+  m_jobs.clear();
+}
+
+void RunQueue::start()
+{
+  m_canceled = false;
+  startQueuedJobs();
+}
+
+void RunQueue::cancel()
+{
+  bool wasRunning = isRunning();
+
+  m_canceled = true;
+
+  for (int i = 0; i < numJobs(); ++i){
+    Job & job = m_jobs[i];
+    if (job.status == JobStatus::Queued){
+      setJobStatus(i, JobStatus::Canceled);
+    } else if ((job.status == JobStatus::Running) && job.process){
+      LOG(Debug, "Kill variant '" << toString(job.name) << "'");
+      job.process->kill();
+    }
+  }
+
+  // running jobs report finished once their process is gone, if there were only queued ones nothing else will
+  if (wasRunning && !isRunning()){
+    emit finished();
+  }
+}
+
+bool RunQueue::isRunning() const
+{
+  for (const auto & job : m_jobs){
+    if ((job.status == JobStatus::Queued) || (job.status == JobStatus::Running)){
+      return true;
+    }
+  }
+  return false;
+}
+
+int RunQueue::numRunning() const
+{
+  int result = 0;
+  for (const auto & job : m_jobs){
+    if (job.status == JobStatus::Running){
+      ++result;
+    }
+  }
+  return result;
+}
+
+int RunQueue::numJobs() const
+{
+  return static_cast<int>(m_jobs.size());
+}
+
+QString RunQueue::jobName(int index) const
+{
+  return m_jobs[index].name;
+}
+
+openstudio::path RunQueue::jobDirectory(int index) const
+{
+  return m_jobs[index].directory;
+}
+
+RunQueue::JobStatus RunQueue::jobStatus(int index) const
+{
+  return m_jobs[index].status;
+}
+
+const RunProgressChannel * RunQueue::progressChannel(int index) const
+{
+  return m_jobs[index].channel;
+}
+
+QString RunQueue::jobStatusName(JobStatus status)
+{
+  switch (status){
+    case JobStatus::Queued: return "Queued";
+    case JobStatus::Running: return "Running";
+    case JobStatus::Succeeded: return "Completed";
+    case JobStatus::Failed: return "Failed";
+    case JobStatus::Canceled: return "Canceled";
+  }
+  return QString();
+}
+
+void RunQueue::setJobStatus(int index, JobStatus status)
+{
+  m_jobs[index].status = status;
+  emit jobStatusChanged(index, status);
+}
+
+void RunQueue::startQueuedJobs()
+{
+  if (m_canceled){
+    return;
+  }
+
+  int running = numRunning();
+  for (int i = 0; (i < numJobs()) && (running < m_maxConcurrentRuns); ++i){
+    if (m_jobs[i].status == JobStatus::Queued){
+      startJob(i);
+      ++running;
+    }
+  }
+}
+
+void RunQueue::startJob(int index)
+{
+  Job & job = m_jobs[index];
+
+  // each job gets its own socket so progress messages can be told apart
+  job.server = new QTcpServer(this);
+  job.server->listen();
+  connect(job.server, &QTcpServer::newConnection, this, [this, index]() {
+    Job & job = m_jobs[index];
+    job.socket = job.server->nextPendingConnection();
+    job.channel->setSocket(job.socket);
+  });
+
+  job.process = new QProcess(this);
+  job.process->setProcessEnvironment(m_environment);
+  job.process->setStandardOutputFile(toQString(job.directory / toPath("stdout")));
+  job.process->setStandardErrorFile(toQString(job.directory / toPath("stderr")));
+  connect(job.process, static_cast<void(QProcess::*)(int, QProcess::ExitStatus)>(&QProcess::finished), this,
+    [this, index](int exitCode, QProcess::ExitStatus exitStatus) { onJobFinished(index, exitCode, exitStatus); });
+  // finished is not emitted if the CLI could not be started
+  connect(job.process, &QProcess::errorOccurred, this, [this, index](QProcess::ProcessError error) {
+    if (error == QProcess::FailedToStart){
+      onJobFinished(index, -1, QProcess::CrashExit);
+    }
+  });
+
+  // Use OpenStudioApplicationPathHelpers to find the CLI
+  QString openstudioExePath = toQString(openstudio::getOpenStudioCoreCLI());
+
+  QStringList arguments;
+  arguments << "run" << "-s" << QString::number(job.server->serverPort()) << "-w" << toQString(job.directory / toPath("workflow.osw"));
+
+  LOG(Debug, "Starting variant '" << toString(job.name) << "' with arguments " << arguments.join(";").toStdString());
+
+  job.channel->reset();
+  setJobStatus(index, JobStatus::Running);
+  job.process->start(openstudioExePath, arguments);
+}
+
+void RunQueue::onJobFinished(int index, int exitCode, QProcess::ExitStatus exitStatus)
+{
+  Job & job = m_jobs[index];
+
+  if (job.socket){
+    job.channel->appendData(job.socket->readAll());
+  }
+  job.channel->flush();
+  job.channel->setSocket(nullptr);
+
+  JobStatus status = JobStatus::Succeeded;
+  if (m_canceled){
+    status = JobStatus::Canceled;
+  } else if ((exitStatus != QProcess::NormalExit) || (exitCode != 0)){
+    status = JobStatus::Failed;
+  }
+
+  LOG(Debug, "Variant '" << toString(job.name) << "' finished with exit code " << exitCode);
+
+  // free the port and process
+  job.process->deleteLater();
+  job.process = nullptr;
+  job.server->deleteLater();
+  job.server = nullptr;
+  job.socket = nullptr;
+
+  setJobStatus(index, status);
+
+  startQueuedJobs();
+
+  if (!isRunning()){
+    emit finished();
+  }
+}
+
+RunQueueView::RunQueueView(RunQueue * runQueue, QWidget * parent)
+  : QWidget(parent),
+    m_runQueue(runQueue)
+{
+  m_layout = new QGridLayout();
+  m_layout->setContentsMargins(0,0,0,0);
+  m_layout->setSpacing(5);
+  m_layout->setAlignment(Qt::AlignTop);
+  setLayout(m_layout);
+
+  m_emptyLabel = new QLabel("No variants have been run. Use \"Run Variants\" to run the model with several weather files.");
+  m_layout->addWidget(m_emptyLabel, 0, 0, 1, 3);
+
+  connect(m_runQueue, &RunQueue::jobStatusChanged, this, &RunQueueView::onJobStatusChanged);
+  connect(m_runQueue, &RunQueue::jobStateChanged, this, &RunQueueView::onJobStateChanged);
+}
+
+void RunQueueView::refresh()
+{
+  for (QWidget * widget : m_rowWidgets){
+    delete widget;
+  }
+  m_rowWidgets.clear();
+  m_progressBars.clear();
+  m_statusLabels.clear();
+
+  m_emptyLabel->setVisible(m_runQueue->numJobs() == 0);
+
+  for (int i = 0; i < m_runQueue->numJobs(); ++i){
+    auto nameLabel = new QLabel(m_runQueue->jobName(i));
+    auto progressBar = new QProgressBar();
+    progressBar->setMaximum(RunProgressChannel::complete);
+    progressBar->setValue(m_runQueue->progressChannel(i)->state());
+    auto statusLabel = new QLabel(RunQueue::jobStatusName(m_runQueue->jobStatus(i)));
+    statusLabel->setFixedWidth(75);
+
+    m_layout->addWidget(nameLabel, i + 1, 0);
+    m_layout->addWidget(progressBar, i + 1, 1);
+    m_layout->addWidget(statusLabel, i + 1, 2);
+
+    m_rowWidgets.push_back(nameLabel);
+    m_rowWidgets.push_back(progressBar);
+    m_rowWidgets.push_back(statusLabel);
+    m_progressBars.push_back(progressBar);
+    m_statusLabels.push_back(statusLabel);
+  }
+}
+
+void RunQueueView::onJobStatusChanged(int index, int status)
+{
+  if (index >= static_cast<int>(m_statusLabels.size())){
+    return;
+  }
+
+  m_statusLabels[index]->setText(RunQueue::jobStatusName(static_cast<RunQueue::JobStatus>(status)));
+  if (status == RunQueue::Failed){
+    m_statusLabels[index]->setStyleSheet("QLabel { color : red; }");
+  } else {
+    m_statusLabels[index]->setStyleSheet("");
+  }
+
+  if (status == RunQueue::Succeeded){
+    m_progressBars[index]->setValue(RunProgressChannel::complete);
+  }
+}
+
+void RunQueueView::onJobStateChanged(int index, int state)
+{
+  if (index < static_cast<int>(m_progressBars.size())){
+    m_progressBars[index]->setValue(state);
+  }
+}
+
+} // openstudio
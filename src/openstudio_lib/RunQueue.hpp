@@ -0,0 +1,183 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef OPENSTUDIO_RUNQUEUE_HPP
+#define OPENSTUDIO_RUNQUEUE_HPP
+
+#include "RunProgressChannel.hpp"
+
+#include <openstudio/utilities/core/Logger.hpp>
+#include <openstudio/utilities/core/Path.hpp>
+#include <openstudio/utilities/filetypes/WorkflowJSON.hpp>
+
+#include <QObject>
+#include <QProcess>
+#include <QProcessEnvironment>
+#include <QWidget>
+
+#include <vector>
+
+class QGridLayout;
+class QLabel;
+class QProgressBar;
+class QTcpServer;
+class QTcpSocket;
+
+namespace openstudio {
+
+// Runs several workflows with the CLI at once, each in its own directory, at most maxConcurrentRuns at a time.
+// Used to run the current model against variants such as different weather files.
+class RunQueue : public QObject
+{
+  Q_OBJECT
+
+ public:
+
+  enum JobStatus { Queued, Running, Succeeded, Failed, Canceled };
+
+  explicit RunQueue(QObject * parent = nullptr);
+
+  virtual ~RunQueue();
+
+  // defaults to the number of cores
+  int maxConcurrentRuns() const;
+
+  void setMaxConcurrentRuns(int maxConcurrentRuns);
+
+  void setProcessEnvironment(const QProcessEnvironment & environment);
+
+  // saves workflow to jobDirectory/workflow.osw, the job is run there when started, returns the job index
+  int addJob(const QString & name, WorkflowJSON workflow, const openstudio::path & jobDirectory);
+
+  // removes all jobs, must not be running
+  void clear();
+
+  void start();
+
+  // kills running jobs and cancels queued ones, finished is emitted once the last job stopped
+  void cancel();
+
+  bool isRunning() const;
+
+  int numJobs() const;
+
+  QString jobName(int index) const;
+
+  openstudio::path jobDirectory(int index) const;
+
+  JobStatus jobStatus(int index) const;
+
+  const RunProgressChannel * progressChannel(int index) const;
+
+  static QString jobStatusName(JobStatus status);
+
+ signals:
+
+  void jobStatusChanged(int index, int status);
+
+  void jobStateChanged(int index, int state);
+
+  void jobMessageReceived(int index, const QString & text, int messageType);
+
+  void finished();
+
+ private:
+
+  REGISTER_LOGGER("openstudio::RunQueue");
+
+  struct Job
+  {
+    QString name;
+    openstudio::path directory;
+    JobStatus status;
+    QProcess * process;
+    QTcpServer * server;
+    QTcpSocket * socket;
+    RunProgressChannel * channel;
+  };
+
+  void startJob(int index);
+
+  void onJobFinished(int index, int exitCode, QProcess::ExitStatus exitStatus);
+
+  void startQueuedJobs();
+
+  void setJobStatus(int index, JobStatus status);
+
+  int numRunning() const;
+
+  std::vector<Job> m_jobs;
+
+  int m_maxConcurrentRuns;
+
+  QProcessEnvironment m_environment;
+
+  bool m_canceled;
+};
+
+// One progress line per job of a RunQueue
+class RunQueueView : public QWidget
+{
+  Q_OBJECT
+
+ public:
+
+  RunQueueView(RunQueue * runQueue, QWidget * parent = nullptr);
+
+  virtual ~RunQueueView() {}
+
+ public slots:
+
+  // rebuilds the rows after jobs are added
+  void refresh();
+
+ private slots:
+
+  void onJobStatusChanged(int index, int status);
+
+  void onJobStateChanged(int index, int state);
+
+ private:
+
+  RunQueue * m_runQueue;
+
+  QGridLayout * m_layout;
+
+  QLabel * m_emptyLabel;
+
+  std::vector<QWidget *> m_rowWidgets;
+
+  std::vector<QProgressBar *> m_progressBars;
+
+  std::vector<QLabel *> m_statusLabels;
+};
+
+} // openstudio
+
+#endif // OPENSTUDIO_RUNQUEUE_HPP
@@ -31,6 +31,8 @@
 
 #include "OSAppBase.hpp"
 #include "OSDocument.hpp"
+#include "RunLogView.hpp"
+#include "RunQueue.hpp"
 #include <openstudio/OpenStudio.hxx>
 
 #include <openstudio/model/FileOperations.hpp>
@@ -68,8 +70,12 @@
 #include "../model_editor/Utilities.hpp"
 
 #include <QButtonGroup>
+#include <QCheckBox>
 #include <QDir>
+#include <QFileDialog>
+#include <QFileInfo>
 #include <QGroupBox>
+#include <QInputDialog>
 #include <QLabel>
 #include <QMessageBox>
 #include <QPainter>
@@ -80,6 +86,7 @@
 #include <QScrollArea>
 #include <QStackedWidget>
 #include <QStyleOption>
+#include <QTabWidget>
 #include <QSysInfo>
 #include <QTimer>
 #include <QToolButton>
@@ -103,8 +110,11 @@ RunTabView::RunTabView(const model::Model & model,
   addTabWidget(m_runView);
 }
 
+// interval at which run messages are appended to the text view
+static const int FLUSH_MESSAGES_MSEC = 100;
+
 RunView::RunView()
-  : QWidget(), m_runSocket(nullptr)
+  : QWidget(), m_runSocket(nullptr), m_tailLogsPending(false)
 {
   auto mainLayout = new QGridLayout();
   mainLayout->setContentsMargins(10,10,10,10);
@@ -130,7 +140,7 @@ RunView::RunView()
 
   // Progress bar area
   m_progressBar = new QProgressBar();
-  m_progressBar->setMaximum(State::complete);
+  m_progressBar->setMaximum(RunProgressChannel::complete);
 
   auto progressbarlayout = new QVBoxLayout();
   progressbarlayout->addWidget(m_progressBar);
@@ -143,9 +153,38 @@ RunView::RunView()
   connect(m_openSimDirButton, &QPushButton::clicked, this, &RunView::onOpenSimDirClicked);
   mainLayout->addWidget(m_openSimDirButton,0,2);
 
+  m_runVariantsButton = new QPushButton();
+  m_runVariantsButton->setText("Run Variants");
+  m_runVariantsButton->setFlat(true);
+  m_runVariantsButton->setObjectName("StandardGrayButton");
+  m_runVariantsButton->setToolTip("Run the model with several weather files at the same time");
+  connect(m_runVariantsButton, &QPushButton::clicked, this, &RunView::onRunVariantsClicked);
+  mainLayout->addWidget(m_runVariantsButton,0,3);
+
+  m_reuseResultsCheckBox = new QCheckBox("Reuse simulation results if nothing changed since the last run");
+  m_reuseResultsCheckBox->setToolTip("If the model, weather file and all measures with their arguments are unchanged since the last successful run, EnergyPlus is not run again and only reporting measures are run. Reporting measures can request simulation outputs, so changing one needs a full run.");
+  m_reuseResultsCheckBox->setChecked(true);
+  mainLayout->addWidget(m_reuseResultsCheckBox,1,1,1,3);
+
   m_textInfo = new QTextEdit();
   m_textInfo->setReadOnly(true);
-  mainLayout->addWidget(m_textInfo,1,0,1,3);
+
+  m_runLogView = new RunLogView();
+
+  m_runQueue = new RunQueue(this);
+  connect(m_runQueue, &RunQueue::finished, this, &RunView::onRunQueueFinished);
+
+  m_runQueueView = new RunQueueView(m_runQueue);
+  auto runQueueScrollArea = new QScrollArea();
+  runQueueScrollArea->setWidgetResizable(true);
+  runQueueScrollArea->setWidget(m_runQueueView);
+
+  m_outputTabWidget = new QTabWidget();
+  m_outputTabWidget->addTab(m_textInfo, "Progress");
+  m_outputTabWidget->addTab(m_runLogView, "Logs");
+  m_outputTabWidget->addTab(runQueueScrollArea, "Variants");
+  connect(m_outputTabWidget, &QTabWidget::currentChanged, this, &RunView::onOutputTabChanged);
+  mainLayout->addWidget(m_outputTabWidget,2,0,1,4);
 
   m_runProcess = new QProcess(this);
   connect(m_runProcess, static_cast<void(QProcess::*)(int, QProcess::ExitStatus)>(&QProcess::finished), this, &RunView::onRunProcessFinished);
@@ -168,10 +207,25 @@ RunView::RunView()
   }
 
   m_runProcess->setProcessEnvironment(env);
+  m_runQueue->setProcessEnvironment(env);
 
   m_runTcpServer = new QTcpServer();
   m_runTcpServer->listen();
   connect(m_runTcpServer, &QTcpServer::newConnection, this, &RunView::onNewConnection);
+
+  m_progressChannel = new RunProgressChannel(this);
+  connect(m_progressChannel, &RunProgressChannel::stateChanged, this, &RunView::onRunStateChanged);
+  connect(m_progressChannel, &RunProgressChannel::messageReceived, this, &RunView::onRunMessageReceived);
+
+  m_flushTimer = new QTimer(this);
+  m_flushTimer->setSingleShot(true);
+  m_flushTimer->setInterval(FLUSH_MESSAGES_MSEC);
+  connect(m_flushTimer, &QTimer::timeout, this, &RunView::flushPendingMessages);
+}
+
+const RunProgressChannel * RunView::progressChannel() const
+{
+  return m_progressChannel;
 }
 
 void RunView::onOpenSimDirClicked()
@@ -188,14 +242,41 @@ void RunView::onRunProcessFinished(int exitCode, QProcess::ExitStatus status)
 {
   LOG(Debug, "run finished");
   m_playButton->setChecked(false);
-  m_state = State::stopped;
-  m_progressBar->setValue(State::complete);
+
+  // socket may still hold unread data and the last partial line
+  if (m_runSocket){
+    m_progressChannel->appendData(m_runSocket->readAll());
+  }
+  m_progressChannel->flush();
+  appendStateTimings();
+  flushPendingMessages();
+
+  m_progressBar->setValue(RunProgressChannel::complete);
+
+  // failed before initialization was done
+  if (m_tailLogsPending){
+    m_tailLogsPending = false;
+    m_runLogView->setRunDirectory(runBasePath());
+  }
+  m_runLogView->stopTailing();
+
+  // remember the inputs of a successful run so the next run can reuse its simulation results
+  if (m_runFingerprint){
+    auto basePath = runBasePath();
+    boost::optional<WorkflowJSON> outWorkflowJSON = WorkflowJSON::load(basePath / toPath("out.osw"));
+    if (outWorkflowJSON && outWorkflowJSON->completedStatus() && (outWorkflowJSON->completedStatus().get() == "Success")){
+      m_runFingerprint->save(basePath / toPath("run/fingerprint.json"));
+    }
+    m_runFingerprint.reset();
+  }
 
   std::shared_ptr<OSDocument> osdocument = OSAppBase::instance()->currentDocument();
   osdocument->save();
   osdocument->enableTabsAfterRun();
   m_openSimDirButton->setEnabled(true);
+  m_runVariantsButton->setEnabled(true);
 
+  m_progressChannel->setSocket(nullptr);
   if (m_runSocket){
     delete m_runSocket;
   }
@@ -228,7 +309,7 @@ void RunView::playButtonClicked(bool t_checked)
     //auto basePath = getCompanionFolder( toPath(osdocument->savePath()) );
 
     // run in temp dir
-    auto basePath = toPath(osdocument->modelTempDir()) / toPath("resources");
+    auto basePath = runBasePath();
 
     auto workflowPath = basePath / "workflow.osw";
     auto stdoutPath = basePath / "stdout";
@@ -236,15 +317,46 @@ void RunView::playButtonClicked(bool t_checked)
 
     OS_ASSERT(exists(workflowPath));
 
+    auto fingerprintPath = basePath / toPath("run/fingerprint.json");
+
+    // the simulation can be skipped if its inputs are unchanged and its outputs are still there. Reporting measures
+    // add output requests during preprocess, a changed one may need data the last eplusout.sql does not have
+    bool postProcessOnly = false;
+    boost::optional<WorkflowJSON> workflowJSON = WorkflowJSON::load(workflowPath);
+    m_runFingerprint.reset();
+    if (workflowJSON){
+      m_runFingerprint = RunFingerprint(*workflowJSON);
+      boost::optional<RunFingerprint> lastFingerprint = RunFingerprint::load(fingerprintPath);
+      postProcessOnly = m_reuseResultsCheckBox->isChecked() && lastFingerprint
+        && (lastFingerprint->simulationHash() == m_runFingerprint->simulationHash())
+        && (lastFingerprint->reportingHash() == m_runFingerprint->reportingHash())
+        && exists(basePath / toPath("run/in.idf"))
+        && exists(basePath / toPath("run/eplusout.sql"));
+    }
+
+    // a run which does not complete must not leave the old fingerprint behind
+    if (exists(fingerprintPath)){
+      remove(fingerprintPath);
+    }
+
     auto workflowJSONPath = QString::fromStdString(workflowPath.string());
     QStringList arguments;
-    arguments << "run" << "-s" << QString::number(m_runTcpServer->serverPort()) << "-w" << workflowJSONPath;
+    arguments << "run";
+    if (postProcessOnly){
+      arguments << "--postprocess_only";
+    }
+    arguments << "-s" << QString::number(m_runTcpServer->serverPort()) << "-w" << workflowJSONPath;
 
     LOG(Debug, "openstudioExePath='" << toString(openstudioExePath) << "'");
     LOG(Debug, "run arguments" << arguments.join(";").toStdString());
 
     osdocument->disableTabsDuringRun();
     m_openSimDirButton->setEnabled(false);
+    // the variants save the document and share the temp dir, they wait for this run
+    m_runVariantsButton->setEnabled(false);
+
+    // log files are memory mapped by the log view, release them so they can be removed
+    m_runLogView->releaseFiles();
 
     if (exists(stdoutPath)){
       remove(stdoutPath);
@@ -254,11 +366,19 @@ void RunView::playButtonClicked(bool t_checked)
     }
 
     m_progressBar->setValue(0);
-    m_state = State::stopped;
+    m_progressChannel->reset();
+    m_flushTimer->stop();
+    m_pendingMessages.clear();
     m_textInfo->clear();
+    if (postProcessOnly){
+      onRunMessageReceived("Simulation inputs are unchanged since the last run, running reporting measures only.", RunProgressChannel::H2Message);
+    }
     m_runProcess->setStandardOutputFile( toQString(stdoutPath) );
     m_runProcess->setStandardErrorFile( toQString(stderrPath) );
     m_runProcess->start(openstudioExePath, arguments);
+
+    // the logs of the previous run are still in run/ until the workflow clears it, see onRunStateChanged
+    m_tailLogsPending = true;
   } else {
     // stop running
     LOG(Debug, "Kill Simulation");
@@ -266,111 +386,195 @@ void RunView::playButtonClicked(bool t_checked)
   }
 }
 
+openstudio::path RunView::runBasePath() const
+{
+  std::shared_ptr<OSDocument> osdocument = OSAppBase::instance()->currentDocument();
+  return toPath(osdocument->modelTempDir()) / toPath("resources");
+}
+
+void RunView::onOutputTabChanged(int index)
+{
+  // show logs of a previous run
+  if ((m_outputTabWidget->widget(index) == m_runLogView) && !m_tailLogsPending){
+    m_runLogView->setRunDirectory(runBasePath());
+  }
+}
+
+void RunView::onRunVariantsClicked()
+{
+  if (m_runQueue->isRunning()){
+    LOG(Debug, "Cancel variants");
+    m_runQueue->cancel();
+    return;
+  }
+
+  std::shared_ptr<OSDocument> osdocument = OSAppBase::instance()->currentDocument();
+
+  if (osdocument->modified()){
+    osdocument->save();
+    // save dialog was canceled
+    if (osdocument->modified()){
+      return;
+    }
+  }
+
+  QStringList weatherFiles = QFileDialog::getOpenFileNames(this, tr("Select Weather Files"), QString(), tr("EnergyPlus Weather Files (*.epw)"));
+  if (weatherFiles.isEmpty()){
+    return;
+  }
+
+  bool ok = false;
+  int maxConcurrentRuns = QInputDialog::getInt(this, tr("Run Variants"), tr("Number of simulations to run at the same time:"),
+    m_runQueue->maxConcurrentRuns(), 1, 256, 1, &ok);
+  if (!ok){
+    return;
+  }
+
+  WorkflowJSON workflowJSON = osdocument->model().workflowJSON();
+  boost::optional<openstudio::path> seedFile = workflowJSON.seedFile();
+  boost::optional<openstudio::path> seedPath;
+  if (seedFile){
+    seedPath = workflowJSON.findFile(*seedFile);
+  }
+  if (!seedPath){
+    QMessageBox::critical(this, "Unable to run variants", "Could not find the seed model of the current workflow.");
+    return;
+  }
+
+  auto variantsPath = runBasePath() / toPath("variants");
+  removeDirectory(variantsPath);
+
+  m_runQueue->clear();
+  m_runQueue->setMaxConcurrentRuns(maxConcurrentRuns);
+
+  for (int i = 0; i < weatherFiles.size(); ++i){
+    const QString & weatherFile = weatherFiles[i];
+
+    // weather files from different folders may share a name, the index keeps their directories apart
+    QString name = QString("%1_%2").arg(QFileInfo(weatherFile).completeBaseName()).arg(i + 1);
+    auto jobDirectory = variantsPath / toPath(name);
+
+    // each variant gets its own copy of the seed so it is isolated from later saves
+    WorkflowJSON variant = workflowJSON.clone();
+    makeParentFolder(jobDirectory / toPath("."), path(), true);
+    openstudio::path variantSeedPath = jobDirectory / seedPath->filename();
+    openstudio::filesystem::copy_file(*seedPath, variantSeedPath, openstudio::filesystem::copy_option::overwrite_if_exists);
+    variant.setSeedFile(variantSeedPath);
+    variant.setWeatherFile(toPath(weatherFile));
+
+    // paths are relative to the original workflow, make them absolute
+    variant.resetMeasurePaths();
+    for (const auto& measurePath : workflowJSON.absoluteMeasurePaths()){
+      variant.addMeasurePath(measurePath);
+    }
+    variant.resetFilePaths();
+    for (const auto& filePath : workflowJSON.absoluteFilePaths()){
+      variant.addFilePath(filePath);
+    }
+
+    m_runQueue->addJob(name, variant, jobDirectory);
+  }
+
+  m_runQueueView->refresh();
+  m_outputTabWidget->setCurrentWidget(m_outputTabWidget->widget(2));
+
+  m_runVariantsButton->setText("Cancel Variants");
+  m_playButton->setEnabled(false);
+  m_runQueue->start();
+}
+
+void RunView::onRunQueueFinished()
+{
+  LOG(Debug, "variants finished");
+  m_runVariantsButton->setText("Run Variants");
+  m_playButton->setEnabled(true);
+
+  // copy the variant results to the companion folder so the results tab finds them, the model itself is not saved,
+  // an unsaved document gets them with the rest of its resources on its first save
+  std::shared_ptr<OSDocument> osdocument = OSAppBase::instance()->currentDocument();
+  if (osdocument->savePath().isEmpty()){
+    return;
+  }
+
+  auto variantsPath = runBasePath() / toPath("variants");
+  auto companionVariantsPath = getCompanionFolder(toPath(osdocument->savePath())) / toPath("variants");
+  removeDirectory(companionVariantsPath);
+  if (!copyDirectory(variantsPath, companionVariantsPath)){
+    LOG(Error, "Could not copy variant results to " << toString(companionVariantsPath));
+  }
+}
+
 void RunView::onNewConnection()
 {
   m_runSocket = m_runTcpServer->nextPendingConnection();
-  connect(m_runSocket,&QTcpSocket::readyRead,this,&RunView::onRunDataReady);
+  m_progressChannel->setSocket(m_runSocket);
+}
+
+void RunView::onRunStateChanged(int state)
+{
+  m_progressBar->setValue(state);
+
+  // run/ is cleared during initialization, the log files are only opened once the run is past it
+  if (m_tailLogsPending && (state > RunProgressChannel::initialization)){
+    m_tailLogsPending = false;
+    m_runLogView->setRunDirectory(runBasePath());
+    m_runLogView->startTailing();
+  }
 }
 
-void RunView::onRunDataReady()
+void RunView::onRunMessageReceived(const QString & text, int messageType)
 {
-  auto appendErrorText = [&](const QString & text) {
-    m_textInfo->setTextColor(Qt::red);
-    m_textInfo->setFontPointSize(18);
-    m_textInfo->append(text);
-  };
-
-  auto appendNormalText = [&](const QString & text) {
-    m_textInfo->setTextColor(Qt::black);
-    m_textInfo->setFontPointSize(12);
-    m_textInfo->append(text);
-  };
-
-  auto appendH1Text = [&](const QString & text) {
-    m_textInfo->setTextColor(Qt::black);
-    m_textInfo->setFontPointSize(18);
-    m_textInfo->append(text);
-  };
-
-  auto appendH2Text = [&](const QString & text) {
-    m_textInfo->setTextColor(Qt::black);
-    m_textInfo->setFontPointSize(15);
-    m_textInfo->append(text);
-  };
-
-  QString data = m_runSocket->readAll();
-  QStringList lines = data.split("\n");
-
-  for (const auto& line: lines){
-    //std::cout << data.toStdString() << std::endl;
-
-    QString trimmedLine = line.trimmed();
-
-    // DLM: coordinate with openstudio-workflow-gem\lib\openstudio\workflow\adapters\output\socket.rb
-    if (trimmedLine.isEmpty()){
-      continue;
-    } else if (QString::compare(trimmedLine, "Starting state initialization", Qt::CaseInsensitive) == 0) {
-      appendH1Text("Initializing workflow.");
-      m_state = State::initialization;
-      m_progressBar->setValue(m_state);
-    } else if (QString::compare(trimmedLine, "Started", Qt::CaseInsensitive) == 0) {
-      // no-op
-    } else if (QString::compare(trimmedLine, "Returned from state initialization", Qt::CaseInsensitive) == 0) {
-      // no-op
-    } else if (QString::compare(trimmedLine, "Starting state os_measures", Qt::CaseInsensitive) == 0) {
-      appendH1Text("Processing OpenStudio Measures.");
-      m_state = State::os_measures;
-      m_progressBar->setValue(m_state);
-    } else if (QString::compare(trimmedLine, "Returned from state os_measures", Qt::CaseInsensitive) == 0) {
-      // no-op
-    } else if (QString::compare(trimmedLine, "Starting state translator", Qt::CaseInsensitive) == 0) {
-      appendH1Text("Translating the OpenStudio Model to EnergyPlus.");
-      m_state = State::translator;
-      m_progressBar->setValue(m_state);
-    } else if (QString::compare(trimmedLine, "Returned from state translator", Qt::CaseInsensitive) == 0) {
-      // no-op
-    } else if (QString::compare(trimmedLine, "Starting state ep_measures", Qt::CaseInsensitive) == 0) {
-      appendH1Text("Processing EnergyPlus Measures.");
-      m_state = State::ep_measures;
-      m_progressBar->setValue(m_state);
-    } else if (QString::compare(trimmedLine, "Returned from state ep_measures", Qt::CaseInsensitive) == 0) {
-      // no-op
-    } else if (QString::compare(trimmedLine, "Starting state preprocess", Qt::CaseInsensitive) == 0) {
-      // ignore this state
-      m_state = State::preprocess;
-      m_progressBar->setValue(m_state);
-    } else if (QString::compare(trimmedLine, "Returned from state preprocess", Qt::CaseInsensitive) == 0) {
-      // ignore this state
-    } else if (QString::compare(trimmedLine, "Starting state simulation", Qt::CaseInsensitive) == 0) {
-      appendH1Text("Starting Simulation.");
-      m_state = State::simulation;
-      m_progressBar->setValue(m_state);
-    } else if (QString::compare(trimmedLine, "Returned from state simulation", Qt::CaseInsensitive) == 0) {
-      // no-op
-    } else if (QString::compare(trimmedLine, "Starting state reporting_measures", Qt::CaseInsensitive) == 0) {
-      appendH1Text("Processing Reporting Measures.");
-      m_state = State::reporting_measures;
-      m_progressBar->setValue(m_state);
-    } else if (QString::compare(trimmedLine, "Returned from state reporting_measures", Qt::CaseInsensitive) == 0) {
-      // no-op
-    } else if (QString::compare(trimmedLine, "Starting state postprocess", Qt::CaseInsensitive) == 0) {
-      appendH1Text("Gathering Reports.");
-      m_state = State::postprocess;
-      m_progressBar->setValue(m_state);
-    } else if (QString::compare(trimmedLine, "Returned from state postprocess", Qt::CaseInsensitive) == 0) {
-      // no-op
-    } else if (QString::compare(trimmedLine, "Failure", Qt::CaseInsensitive) == 0) {
-      appendErrorText("Failed.");
-    } else if (QString::compare(trimmedLine, "Complete", Qt::CaseInsensitive) == 0) {
-      appendH1Text("Completed.");
-    } else if (trimmedLine.startsWith("Applying", Qt::CaseInsensitive)) {
-      appendH2Text(line);
-    } else if (trimmedLine.startsWith("Applied", Qt::CaseInsensitive)) {
-      // no-op
-    } else{
-      appendNormalText(line);
+  QString color = "black";
+  int pointSize = 12;
+  switch (messageType){
+    case RunProgressChannel::ErrorMessage:
+      color = "red";
+      pointSize = 18;
+      break;
+    case RunProgressChannel::H1Message:
+      pointSize = 18;
+      break;
+    case RunProgressChannel::H2Message:
+      pointSize = 15;
+      break;
+    default:
+      break;
+  }
+
+  m_pendingMessages << QString("<span style=\"color:%1; font-size:%2pt; white-space:pre-wrap;\">%3</span>").arg(color).arg(pointSize).arg(text.toHtmlEscaped());
+
+  if (!m_flushTimer->isActive()){
+    m_flushTimer->start();
+  }
+}
+
+void RunView::flushPendingMessages()
+{
+  m_flushTimer->stop();
+
+  if (m_pendingMessages.isEmpty()){
+    return;
+  }
+
+  m_textInfo->append(m_pendingMessages.join("<br>"));
+  m_pendingMessages.clear();
+}
+
+void RunView::appendStateTimings()
+{
+  QStringList timings;
+  for (int i = RunProgressChannel::initialization; i < RunProgressChannel::complete; ++i){
+    auto state = static_cast<RunProgressChannel::State>(i);
+    qint64 msecs = m_progressChannel->stateDurationMSecs(state);
+    if (msecs >= 0){
+      LOG(Debug, toString(RunProgressChannel::stateDisplayName(state)) << " took " << msecs << " ms");
+      timings << QString("%1: %2 s").arg(RunProgressChannel::stateDisplayName(state)).arg(msecs / 1000.0, 0, 'f', 1);
     }
   }
+
+  if (!timings.isEmpty()){
+    onRunMessageReceived("Elapsed time per step. " + timings.join(", "), RunProgressChannel::NormalMessage);
+  }
 }
 
 } // openstudio
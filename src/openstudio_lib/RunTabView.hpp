@@ -34,6 +34,8 @@
 #include <openstudio/utilities/idf/WorkspaceObject_Impl.hpp>
 #include <boost/smart_ptr.hpp>
 #include "MainTabView.hpp"
+#include "RunFingerprint.hpp"
+#include "RunProgressChannel.hpp"
 #include <QComboBox>
 #include <QWidget>
 #include <QProcess>
@@ -42,19 +44,28 @@
 //#include "../runmanager/lib/Workflow.hpp"
 
 class QButtonGroup;
+class QCheckBox;
 class QPlainTextEdit;
 class QProgressBar;
 class QPushButton;
 class QRadioButton;
 class QStackedWidget;
 class QToolButton;
+class QTabWidget;
 class QTextEdit;
 class QFileSystemWatcher;
 class QTcpServer;
 class QTcpSocket;
+class QTimer;
 
 namespace openstudio {
 
+  class RunLogView;
+
+  class RunQueue;
+
+  class RunQueueView;
+
   class RunView;
 
   class RunView : public QWidget
@@ -65,6 +76,9 @@ namespace openstudio {
 
     RunView();
 
+    // timing of the workflow states of the current or last run
+    const RunProgressChannel * progressChannel() const;
+
     private:
 
     REGISTER_LOGGER("openstudio::RunView");
@@ -79,23 +93,49 @@ namespace openstudio {
 
     void onOpenSimDirClicked();
 
+    // runs the model once per selected weather file, in parallel
+    void onRunVariantsClicked();
+
+    void onRunQueueFinished();
+
     void onNewConnection();
 
-    void onRunDataReady();
+    void onRunStateChanged(int state);
+
+    void onRunMessageReceived(const QString & text, int messageType);
+
+    // appends all pending messages to m_textInfo in a single document update
+    void flushPendingMessages();
+
+    void appendStateTimings();
+
+    void onOutputTabChanged(int index);
+
+    openstudio::path runBasePath() const;
 
     QToolButton * m_playButton;
     QProgressBar * m_progressBar;
     QLabel * m_statusLabel;
     QTextEdit * m_textInfo;
+    QTabWidget * m_outputTabWidget;
+    RunLogView * m_runLogView;
+    QPushButton * m_runVariantsButton;
+    QCheckBox * m_reuseResultsCheckBox;
+    // fingerprint of the running workflow, saved if the run succeeds
+    boost::optional<RunFingerprint> m_runFingerprint;
+    RunQueue * m_runQueue;
+    RunQueueView * m_runQueueView;
     QProcess * m_runProcess;
     QPushButton * m_openSimDirButton;
     QTcpServer * m_runTcpServer;
     QTcpSocket * m_runSocket;
+    RunProgressChannel * m_progressChannel;
+    QTimer * m_flushTimer;
+    QStringList m_pendingMessages;
+    // a run started but the log view does not follow it yet
+    bool m_tailLogsPending;
     //QFileSystemWatcher * m_simDirWatcher;
     //QFileSystemWatcher * m_eperrWatcher;
-
-    enum State { stopped = 0, initialization = 1, os_measures = 2, translator = 3, ep_measures = 4, preprocess = 5, simulation = 6, reporting_measures = 7, postprocess = 8, complete = 9 };
-    State m_state = State::stopped;
   };
 
   class RunTabView : public MainTabView
@@ -1558,6 +1558,19 @@ DaySchedulePlotArea::DaySchedulePlotArea(ScheduleDayEditor * scheduleDayEditor)
 
   connect(this, &DaySchedulePlotArea::keyboardPromptChanged, m_scheduleDayEditor, &ScheduleDayEditor::updateKeyboardPrompt);
   setFocusPolicy(Qt::StrongFocus);
+
+  m_dragTimer = new QTimer(this);
+  m_dragTimer->setSingleShot(true);
+  m_dragTimer->setInterval(100);
+  connect(m_dragTimer, &QTimer::timeout, this, &DaySchedulePlotArea::onDragTimeout);
+}
+
+void DaySchedulePlotArea::onDragTimeout()
+{
+  if( m_currentItem )
+  {
+    emit dayScheduleSceneChanged(scene(),scene()->scheduleDayView()->lowerViewLimit(),scene()->scheduleDayView()->upperViewLimit());
+  }
 }
 
 void DaySchedulePlotArea::updateKeyboardPrompt()
@@ -1738,6 +1751,11 @@ void DaySchedulePlotArea::mouseMoveEvent(QMouseEvent * event)
       }
 
       scene()->update();
+
+      if( ! m_dragTimer->isActive() )
+      {
+        m_dragTimer->start();
+      }
     }
     else if( VCalendarSegmentItem * calendarItem = dynamic_cast<VCalendarSegmentItem *>(m_currentItem) )
     {
@@ -1796,6 +1814,11 @@ void DaySchedulePlotArea::mouseMoveEvent(QMouseEvent * event)
         calendarItem->setTime(newTime);
 
         scene()->update();
+
+        if( ! m_dragTimer->isActive() )
+        {
+          m_dragTimer->start();
+        }
       }
     }
   }
@@ -1876,12 +1899,45 @@ void DaySchedulePlotArea::mousePressEvent(QMouseEvent * event)
 
       m_currentItem = calendarItem;
     }
+
+    if( m_currentItem )
+    {
+      scene()->setDragging(true);
+    }
   }
 
   QGraphicsView::mousePressEvent(event);
 }
 
 void DaySchedulePlotArea::mouseReleaseEvent(QMouseEvent * event)
+{
+  endDrag();
+
+  QGraphicsView::mouseReleaseEvent(event);
+}
+
+void DaySchedulePlotArea::focusOutEvent(QFocusEvent * event)
+{
+  // the release may never come, do not leave the scene waiting with refreshes
+  if( m_currentItem )
+  {
+    endDrag();
+  }
+
+  QGraphicsView::focusOutEvent(event);
+}
+
+void DaySchedulePlotArea::leaveEvent(QEvent * event)
+{
+  if( m_currentItem )
+  {
+    endDrag();
+  }
+
+  QGraphicsView::leaveEvent(event);
+}
+
+void DaySchedulePlotArea::endDrag()
 {
   QList<QGraphicsItem *> items = this->items();
 
@@ -1899,11 +1955,13 @@ void DaySchedulePlotArea::mouseReleaseEvent(QMouseEvent * event)
     }
   }
 
+  m_dragTimer->stop();
+
   emit dayScheduleSceneChanged(scene(),scene()->scheduleDayView()->lowerViewLimit(),scene()->scheduleDayView()->upperViewLimit());
 
-  m_currentItem = nullptr;
+  scene()->setDragging(false);
 
-  QGraphicsView::mouseReleaseEvent(event);
+  m_currentItem = nullptr;
 }
 
 void DaySchedulePlotArea::keyPressEvent(QKeyEvent * event)
@@ -1990,7 +2048,8 @@ DayScheduleScene::DayScheduleScene(ScheduleDayView * scheduleDayView, const mode
     m_lowerScheduleTypeLimitItem(nullptr),
     m_scheduleDayView(scheduleDayView),
     m_scheduleDay(scheduleDay),
-    m_dirty(true)
+    m_dirty(true),
+    m_dragging(false)
 {
   setSceneRect(0,0,SCENEWIDTH,SCENEHEIGHT);
 
@@ -2012,12 +2071,20 @@ void DayScheduleScene::scheduleRefresh()
   QTimer::singleShot(0,this,SLOT(refresh()));
 }
 
-void DayScheduleScene::refresh()
+void DayScheduleScene::setDragging(bool dragging)
 {
-  if( m_dirty )
+  m_dragging = dragging;
+
+  if( ! m_dragging && m_dirty )
   {
-    clearSegments();
+    QTimer::singleShot(0,this,SLOT(refresh()));
+  }
+}
 
+void DayScheduleScene::refresh()
+{
+  if( m_dirty && ! m_dragging )
+  {
     std::vector<openstudio::Time> times = m_scheduleDay.times();
 
     // Get the values as is
@@ -2074,79 +2141,223 @@ void DayScheduleScene::refresh()
       lowerViewLimit = minvalue; // - 0.05 * (maxvalue - minvalue);
     }
 
-    if (upperTypeLimit){
-      double scaledValue = (*upperTypeLimit - lowerViewLimit) / (upperViewLimit - lowerViewLimit);
-      if (scaledValue > 0.0 && scaledValue < 1.0){
-        m_upperScheduleTypeLimitItem = new ScheduleTypeLimitItem(true);
-        addItem(m_upperScheduleTypeLimitItem);
-        m_upperScheduleTypeLimitItem->setValue(scaledValue);
-      }
+    updateTypeLimitItem(m_upperScheduleTypeLimitItem, true, upperTypeLimit, lowerViewLimit, upperViewLimit);
+
+    updateTypeLimitItem(m_lowerScheduleTypeLimitItem, false, lowerTypeLimit, lowerViewLimit, upperViewLimit);
+
+    std::vector<double> endTimes;
+    std::vector<double> scaledValues;
+    std::vector<bool> isOutOfTypeLimits;
+
+    for( unsigned i = 0; i < times.size(); ++i )
+    {
+      endTimes.push_back(times[i].totalSeconds());
+
+      scaledValues.push_back((realvalues[i] - lowerViewLimit) / (upperViewLimit - lowerViewLimit));
+
+      isOutOfTypeLimits.push_back((upperTypeLimit && (realvalues[i] > *upperTypeLimit)) || (lowerTypeLimit && (realvalues[i] < *lowerTypeLimit)));
     }
 
-    if (lowerTypeLimit){
-      double scaledValue = (*lowerTypeLimit - lowerViewLimit) / (upperViewLimit - lowerViewLimit);
-      if (scaledValue > 0.0 && scaledValue < 1.0){
-        m_lowerScheduleTypeLimitItem = new ScheduleTypeLimitItem(false);
-        addItem(m_lowerScheduleTypeLimitItem);
-        m_lowerScheduleTypeLimitItem->setValue(scaledValue);
-      }
+    updateSegments(endTimes, scaledValues, isOutOfTypeLimits);
+
+    m_scheduleDayView->update();
+
+    m_dirty = false;
+  }
+}
+
+void DayScheduleScene::updateTypeLimitItem(ScheduleTypeLimitItem * & item, bool isUpperLimit, const boost::optional<double> & typeLimit,
+                                           double lowerViewLimit, double upperViewLimit)
+{
+  boost::optional<double> scaledValue;
+
+  if( typeLimit )
+  {
+    double value = (*typeLimit - lowerViewLimit) / (upperViewLimit - lowerViewLimit);
+
+    if( value > 0.0 && value < 1.0 )
+    {
+      scaledValue = value;
     }
+  }
 
-    int i  = 0;
-    double lastTime = 0.0;
-    CalendarSegmentItem * previousSegment = nullptr;
+  if( scaledValue )
+  {
+    if( ! item )
+    {
+      item = new ScheduleTypeLimitItem(isUpperLimit);
+      addItem(item);
+    }
 
-    for( auto it = times.begin();
-         it < times.end();
-         ++it )
+    item->setValue(*scaledValue);
+  }
+  else if( item )
+  {
+    delete item;
+
+    item = nullptr;
+  }
+}
+
+void DayScheduleScene::updateSegments(const std::vector<double> & endTimes,
+                                      const std::vector<double> & values,
+                                      const std::vector<bool> & isOutOfTypeLimits)
+{
+  std::vector<CalendarSegmentItem *> items = segments();
+
+  size_t oldSize = items.size();
+  size_t newSize = endTimes.size();
+
+  auto isSame = [&](size_t oldIndex, size_t newIndex) {
+    return (items[oldIndex]->endTime() == endTimes[newIndex]) &&
+           (std::fabs(items[oldIndex]->value() - values[newIndex]) < 1E-10) &&
+           (items[oldIndex]->isOutOfTypeLimits() == isOutOfTypeLimits[newIndex]);
+  };
+
+  // An edit touches a run of segments, everything before and after it stays as it is
+  size_t prefix = 0;
+
+  while( prefix < oldSize && prefix < newSize && isSame(prefix, prefix) )
+  {
+    ++prefix;
+  }
+
+  size_t suffix = 0;
+
+  while( suffix < oldSize - prefix && suffix < newSize - prefix && isSame(oldSize - 1 - suffix, newSize - 1 - suffix) )
+  {
+    ++suffix;
+  }
+
+  size_t oldEnd = oldSize - suffix;
+  size_t newEnd = newSize - suffix;
+
+  // The changed run reuses the old items in place, the difference in count is inserted or removed at its end
+  size_t reused = std::min(oldEnd - prefix, newEnd - prefix);
+
+  std::vector<CalendarSegmentItem *> result(items.begin(), items.begin() + prefix + reused);
+
+  for( size_t i = prefix + reused; i < oldEnd; ++i )
+  {
+    removeSegment(items[i]);
+  }
+
+  for( size_t i = prefix + reused; i < newEnd; ++i )
+  {
+    result.push_back(insertSegmentAfter(result.empty() ? nullptr : result.back()));
+  }
+
+  result.insert(result.end(), items.begin() + oldEnd, items.end());
+
+  OS_ASSERT(result.size() == newSize);
+
+  for( size_t i = prefix; i < newEnd; ++i )
+  {
+    CalendarSegmentItem * segment = result[i];
+
+    segment->setEndTime(endTimes[i]);
+
+    segment->setValue(values[i]);
+
+    segment->setIsOutOfTypeLimits(isOutOfTypeLimits[i]);
+
+    segment->update();
+  }
+
+  // Start times and vertical items from the first changed segment up to the first unchanged one after it
+  for( size_t i = prefix; i < std::min(newEnd + 1, newSize); ++i )
+  {
+    double startTime = (i == 0) ? 0.0 : endTimes[i - 1];
+
+    if( VCalendarSegmentItem * vSegment = result[i]->previousVCalendarItem() )
     {
-      bool isOutOfTypeLimits = false;
-      if (upperTypeLimit && (realvalues[i] > *upperTypeLimit)){
-        isOutOfTypeLimits = true;
-      } else if (lowerTypeLimit && (realvalues[i] < *lowerTypeLimit)){
-        isOutOfTypeLimits = true;
-      }
+      vSegment->setTime(startTime);
 
-      double scaledValue = (realvalues[i] - lowerViewLimit) / (upperViewLimit - lowerViewLimit);
+      vSegment->updateLength();
+    }
+    else
+    {
+      result[i]->setStartTime(startTime);
+    }
+  }
+}
 
-      auto segment = new CalendarSegmentItem();
-      addItem(segment);
-      segment->setValue(scaledValue);
-      segment->setIsOutOfTypeLimits(isOutOfTypeLimits);
-      segment->setStartTime(lastTime);
-      double time = it->totalSeconds();
-      segment->setEndTime(time);
+CalendarSegmentItem * DayScheduleScene::insertSegmentAfter(CalendarSegmentItem * previous)
+{
+  auto segment = new CalendarSegmentItem();
+  addItem(segment);
 
-      if( previousSegment )
-      {
-        auto vSegment = new VCalendarSegmentItem();
-        addItem(vSegment);
+  if( previous )
+  {
+    VCalendarSegmentItem * nextVSegment = previous->nextVCalendarItem();
 
-        segment->setPreviousVCalendarItem(vSegment);
-        vSegment->setNextCalendarItem(segment);
-        vSegment->setPreviousCalendarItem(previousSegment);
-        previousSegment->setNextVCalendarItem(vSegment);
+    auto vSegment = new VCalendarSegmentItem();
+    addItem(vSegment);
 
-        vSegment->setTime(lastTime);
+    vSegment->setPreviousCalendarItem(previous);
+    vSegment->setNextCalendarItem(segment);
+    previous->setNextVCalendarItem(vSegment);
+    segment->setPreviousVCalendarItem(vSegment);
 
-        vSegment->updateLength();
-      }
-      else
-      {
-        m_firstSegment = segment;
-      }
+    if( nextVSegment )
+    {
+      nextVSegment->setPreviousCalendarItem(segment);
+      segment->setNextVCalendarItem(nextVSegment);
+    }
+  }
+  else if( m_firstSegment )
+  {
+    auto vSegment = new VCalendarSegmentItem();
+    addItem(vSegment);
 
-      previousSegment = segment;
+    vSegment->setPreviousCalendarItem(segment);
+    vSegment->setNextCalendarItem(m_firstSegment);
+    segment->setNextVCalendarItem(vSegment);
+    m_firstSegment->setPreviousVCalendarItem(vSegment);
 
-      lastTime = time;
+    m_firstSegment = segment;
+  }
+  else
+  {
+    m_firstSegment = segment;
+  }
+
+  return segment;
+}
+
+void DayScheduleScene::removeSegment(CalendarSegmentItem * segment)
+{
+  VCalendarSegmentItem * previousVSegment = segment->previousVCalendarItem();
 
-      i++;
+  VCalendarSegmentItem * nextVSegment = segment->nextVCalendarItem();
+
+  if( previousVSegment )
+  {
+    // the vertical item after the segment now follows the one before it
+    CalendarSegmentItem * previous = previousVSegment->previousCalendarItem();
+
+    previous->setNextVCalendarItem(nextVSegment);
+
+    if( nextVSegment )
+    {
+      nextVSegment->setPreviousCalendarItem(previous);
     }
 
-    m_scheduleDayView->update();
+    delete previousVSegment;
+  }
+  else
+  {
+    m_firstSegment = segment->nextCalendarItem();
 
-    m_dirty = false;
+    if( m_firstSegment )
+    {
+      m_firstSegment->setPreviousVCalendarItem(nullptr);
+
+      delete nextVSegment;
+    }
   }
+
+  delete segment;
 }
 
 ScheduleDayView * DayScheduleScene::scheduleDayView() const
@@ -2241,36 +2452,6 @@ CalendarSegmentItem * DayScheduleScene::addSegment(double untilTime)
   return item;
 }
 
-void DayScheduleScene::clearSegments()
-{
-  std::vector<CalendarSegmentItem *> _segments = segments();
-
-  for( auto it = _segments.begin();
-       it < _segments.end();
-       ++it )
-  {
-    if( VCalendarSegmentItem * vItem = (*it)->nextVCalendarItem() )
-    {
-      delete vItem;
-    }
-
-    delete *it;
-  }
-
-  m_firstSegment = nullptr;
-
-  if (m_upperScheduleTypeLimitItem){
-    delete m_upperScheduleTypeLimitItem;
-  }
-  m_upperScheduleTypeLimitItem = nullptr;
-
-  if (m_lowerScheduleTypeLimitItem){
-    delete m_lowerScheduleTypeLimitItem;
-  }
-  m_lowerScheduleTypeLimitItem = nullptr;
-
-}
-
 std::vector<CalendarSegmentItem *> DayScheduleScene::segments() const
 {
   std::vector<CalendarSegmentItem *> result;
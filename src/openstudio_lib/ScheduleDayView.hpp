@@ -52,6 +52,8 @@ class QLabel;
 
 class QDoubleSpinBox;
 
+class QTimer;
+
 namespace openstudio {
 
 class Unit;
@@ -320,8 +322,6 @@ class DayScheduleScene : public QGraphicsScene, public Nano::Observer
 
   CalendarSegmentItem * addSegment(double untilTime);
 
-  void clearSegments();
-
   std::vector<CalendarSegmentItem *> segments() const;
 
   CalendarSegmentItem * segmentAt(double time) const;
@@ -334,6 +334,9 @@ class DayScheduleScene : public QGraphicsScene, public Nano::Observer
 
   QGraphicsItem * segmentAt(double x, double y, double zoom) const;
 
+  // Refreshes wait while a segment is dragged, so the dragged items are not moved under the mouse
+  void setDragging(bool dragging);
+
   public slots:
 
   void scheduleRefresh();
@@ -344,6 +347,19 @@ class DayScheduleScene : public QGraphicsScene, public Nano::Observer
 
   private:
 
+  // Brings the segment items in line with the schedule, only the items that differ are moved, inserted or removed
+  void updateSegments(const std::vector<double> & endTimes,
+                      const std::vector<double> & values,
+                      const std::vector<bool> & isOutOfTypeLimits);
+
+  // Adds a segment after previous, or first when previous is null, with the vertical items that join them
+  CalendarSegmentItem * insertSegmentAfter(CalendarSegmentItem * previous);
+
+  void removeSegment(CalendarSegmentItem * segment);
+
+  void updateTypeLimitItem(ScheduleTypeLimitItem * & item, bool isUpperLimit, const boost::optional<double> & typeLimit,
+                           double lowerViewLimit, double upperViewLimit);
+
   CalendarSegmentItem * m_firstSegment;
 
   ScheduleTypeLimitItem * m_upperScheduleTypeLimitItem;
@@ -355,6 +371,8 @@ class DayScheduleScene : public QGraphicsScene, public Nano::Observer
   model::ScheduleDay m_scheduleDay;
 
   bool m_dirty;
+
+  bool m_dragging;
 };
 
 class DaySchedulePlotArea : public QGraphicsView
@@ -393,14 +411,28 @@ class DaySchedulePlotArea : public QGraphicsView
 
   void mouseReleaseEvent(QMouseEvent * event) override;
 
+  void focusOutEvent(QFocusEvent * event) override;
+
+  void leaveEvent(QEvent * event) override;
+
   void keyPressEvent (QKeyEvent * event) override;
 
+  private slots:
+
+  void onDragTimeout();
+
   private:
 
   void updateKeyboardPrompt();
 
+  // Writes the dragged segment to the model and lets the scene refresh again
+  void endDrag();
+
   ScheduleDayEditor * m_scheduleDayEditor;
 
+  // Writes a drag to the model at most once per interval
+  QTimer * m_dragTimer;
+
   QGraphicsItem * m_currentItem;
 
   QGraphicsItem * m_currentHoverItem;
@@ -0,0 +1,646 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+
+#include "ScheduleEvaluation.hpp"
+
+#include "OSAppBase.hpp"
+
+#include <openstudio/model/Model_Impl.hpp>
+#include <openstudio/model/ScheduleDay.hpp>
+#include <openstudio/model/ScheduleDay_Impl.hpp>
+#include <openstudio/model/ScheduleRule.hpp>
+#include <openstudio/model/ScheduleRule_Impl.hpp>
+#include <openstudio/model/ScheduleRuleset_Impl.hpp>
+#include <openstudio/model/YearDescription.hpp>
+#include <openstudio/model/YearDescription_Impl.hpp>
+
+#include <openstudio/utilities/core/Assert.hpp>
+#include <openstudio/utilities/core/Compare.hpp>
+#include <openstudio/utilities/time/Date.hpp>
+#include <openstudio/utilities/time/Time.hpp>
+
+#include <QTimer>
+#include <QtConcurrent>
+
+#include <algorithm>
+
+namespace openstudio {
+
+// Holds the connections to the objects a ruleset's results depend on, they all go when it is deleted
+class ScheduleRulesetObserver : public Nano::Observer
+{
+ public:
+
+  ScheduleRulesetObserver(ScheduleEvaluator * evaluator, const model::ScheduleRuleset & scheduleRuleset)
+    : m_evaluator(evaluator),
+      m_handle(scheduleRuleset.handle())
+  {
+    scheduleRuleset.getImpl<model::detail::ScheduleRuleset_Impl>().get()->onChange.connect<ScheduleRulesetObserver, &ScheduleRulesetObserver::onChange>(this);
+
+    scheduleRuleset.defaultDaySchedule().getImpl<model::detail::ScheduleDay_Impl>().get()->onChange.connect<ScheduleRulesetObserver, &ScheduleRulesetObserver::onChange>(this);
+
+    for( const auto & rule : scheduleRuleset.scheduleRules() )
+    {
+      rule.getImpl<model::detail::ScheduleRule_Impl>().get()->onChange.connect<ScheduleRulesetObserver, &ScheduleRulesetObserver::onChange>(this);
+
+      rule.getImpl<model::detail::ScheduleRule_Impl>().get()->onRemoveFromWorkspace.connect<ScheduleRulesetObserver, &ScheduleRulesetObserver::onRemoveFromWorkspace>(this);
+
+      rule.daySchedule().getImpl<model::detail::ScheduleDay_Impl>().get()->onChange.connect<ScheduleRulesetObserver, &ScheduleRulesetObserver::onChange>(this);
+    }
+  }
+
+  void onChange()
+  {
+    m_evaluator->invalidateLater(m_handle);
+  }
+
+  void onRemoveFromWorkspace(const Handle &)
+  {
+    m_evaluator->invalidateLater(m_handle);
+  }
+
+ private:
+
+  ScheduleEvaluator * m_evaluator;
+
+  Handle m_handle;
+};
+
+static ScheduleDayData scheduleDayData(const model::ScheduleDay & scheduleDay)
+{
+  ScheduleDayData result;
+
+  for( const auto & time : scheduleDay.times() )
+  {
+    result.untilHours.push_back(time.totalHours());
+  }
+
+  result.values = scheduleDay.values();
+
+  result.interpolate = scheduleDay.interpolatetoTimestep();
+
+  return result;
+}
+
+ScheduleRulesetData scheduleRulesetData(const model::ScheduleRuleset & scheduleRuleset)
+{
+  ScheduleRulesetData result;
+
+  result.handle = scheduleRuleset.handle();
+
+  int year = scheduleRuleset.model().getUniqueModelObject<model::YearDescription>().assumedYear();
+
+  Date startDate(1, 1, year);
+  Date endDate(12, 31, year);
+
+  result.numberOfDays = endDate.dayOfYear();
+
+  result.firstDayOfWeek = startDate.dayOfWeek().value();
+
+  result.days.push_back(scheduleDayData(scheduleRuleset.defaultDaySchedule()));
+
+  for( const auto & rule : scheduleRuleset.scheduleRules() )
+  {
+    ScheduleRuleData ruleData;
+
+    ruleData.dateRange = istringEqual("DateRange", rule.dateSpecificationType());
+
+    if( ruleData.dateRange )
+    {
+      boost::optional<Date> ruleStartDate = rule.startDate();
+      boost::optional<Date> ruleEndDate = rule.endDate();
+
+      // a rule without both dates never applies, as in ScheduleRule::containsDate
+      if( ruleStartDate && ruleEndDate )
+      {
+        ruleData.startDay = ruleStartDate->dayOfYear();
+        ruleData.endDay = ruleEndDate->dayOfYear();
+      }
+    }
+    else
+    {
+      for( const auto & date : rule.specificDates() )
+      {
+        ruleData.specificDays.push_back(date.dayOfYear());
+      }
+    }
+
+    ruleData.applyDayOfWeek[0] = rule.applySunday();
+    ruleData.applyDayOfWeek[1] = rule.applyMonday();
+    ruleData.applyDayOfWeek[2] = rule.applyTuesday();
+    ruleData.applyDayOfWeek[3] = rule.applyWednesday();
+    ruleData.applyDayOfWeek[4] = rule.applyThursday();
+    ruleData.applyDayOfWeek[5] = rule.applyFriday();
+    ruleData.applyDayOfWeek[6] = rule.applySaturday();
+
+    result.rules.push_back(ruleData);
+
+    result.days.push_back(scheduleDayData(rule.daySchedule()));
+  }
+
+  return result;
+}
+
+std::vector<int> activeRuleIndices(const ScheduleRulesetData & data)
+{
+  std::vector<int> result(data.numberOfDays, -1);
+
+  // Rules are in priority order, so each one only fills the days no rule before it took
+  for( int ruleIndex = static_cast<int>(data.rules.size()) - 1; ruleIndex >= 0; --ruleIndex )
+  {
+    const ScheduleRuleData & rule = data.rules[ruleIndex];
+
+    for( int day = 1; day <= data.numberOfDays; ++day )
+    {
+      bool containsDay = false;
+
+      if( rule.dateRange )
+      {
+        if( rule.startDay > 0 && rule.endDay > 0 )
+        {
+          if( rule.startDay <= rule.endDay )
+          {
+            containsDay = (day >= rule.startDay) && (day <= rule.endDay);
+          }
+          else
+          {
+            containsDay = (day >= rule.startDay) || (day <= rule.endDay);
+          }
+        }
+      }
+      else
+      {
+        containsDay = std::find(rule.specificDays.begin(), rule.specificDays.end(), day) != rule.specificDays.end();
+      }
+
+      if( containsDay && rule.applyDayOfWeek[(data.firstDayOfWeek + day - 1) % 7] )
+      {
+        result[day - 1] = ruleIndex;
+      }
+    }
+  }
+
+  return result;
+}
+
+// Average value of the day over each of stepsPerDay equal steps
+static std::vector<double> dayStepValues(const ScheduleDayData & day, int stepsPerDay)
+{
+  std::vector<double> result(stepsPerDay, 0.0);
+
+  size_t n = std::min(day.untilHours.size(), day.values.size());
+
+  if( n == 0 ) return result;
+
+  // Value at hour t of interval i, which ramps from the value of the interval before when interpolating
+  auto valueAt = [&day](size_t i, double t) {
+    if( ! day.interpolate || i == 0 ) return day.values[i];
+
+    double start = day.untilHours[i - 1];
+    double length = day.untilHours[i] - start;
+
+    if( length <= 0.0 ) return day.values[i];
+
+    return day.values[i - 1] + (day.values[i] - day.values[i - 1]) * (t - start) / length;
+  };
+
+  // Integral of the day from midnight to the end of each step, walking the intervals once
+  std::vector<double> integrals(stepsPerDay + 1, 0.0);
+
+  size_t i = 0;
+  double t = 0.0;
+  double integral = 0.0;
+
+  for( int step = 1; step <= stepsPerDay; ++step )
+  {
+    double stepEnd = 24.0 * step / stepsPerDay;
+
+    while( t < stepEnd )
+    {
+      // the last interval runs to the end of the day
+      double until = (i + 1 < n) ? day.untilHours[i] : 24.0;
+
+      if( until <= t )
+      {
+        ++i;
+
+        continue;
+      }
+
+      double segmentEnd = std::min(until, stepEnd);
+
+      integral += 0.5 * (valueAt(i, t) + valueAt(i, segmentEnd)) * (segmentEnd - t);
+
+      t = segmentEnd;
+    }
+
+    integrals[step] = integral;
+  }
+
+  // Straight loop over contiguous arrays, vectorized by the compiler
+  double stepsPerHour = stepsPerDay / 24.0;
+
+  for( int step = 0; step < stepsPerDay; ++step )
+  {
+    result[step] = (integrals[step + 1] - integrals[step]) * stepsPerHour;
+  }
+
+  return result;
+}
+
+std::vector<double> annualValues(const ScheduleRulesetData & data, const std::vector<int> & activeRuleIndices, int minutesPerStep)
+{
+  OS_ASSERT((minutesPerStep >= 1) && (minutesPerStep <= 60) && (60 % minutesPerStep == 0));
+
+  int stepsPerDay = 24 * 60 / minutesPerStep;
+
+  // Each distinct day is worked out once, the year is then copied together a day at a time
+  std::vector<std::vector<double> > dayValues;
+
+  for( const auto & day : data.days )
+  {
+    dayValues.push_back(dayStepValues(day, stepsPerDay));
+  }
+
+  std::vector<double> result(stepsPerDay * activeRuleIndices.size());
+
+  auto it = result.begin();
+
+  for( int ruleIndex : activeRuleIndices )
+  {
+    const std::vector<double> & values = dayValues[ruleIndex + 1];
+
+    it = std::copy(values.begin(), values.end(), it);
+  }
+
+  return result;
+}
+
+std::vector<double> hourlyValues(const ScheduleRulesetData & data, const std::vector<int> & activeRuleIndices)
+{
+  return annualValues(data, activeRuleIndices, 60);
+}
+
+ScheduleStatistics scheduleStatistics(const std::vector<double> & values, int minutesPerStep)
+{
+  ScheduleStatistics result;
+
+  if( values.empty() ) return result;
+
+  double minimum = values.front();
+  double maximum = values.front();
+  double sum = 0.0;
+  double nonZeroSteps = 0.0;
+
+  // One pass without branches
+  for( double value : values )
+  {
+    minimum = std::min(minimum, value);
+    maximum = std::max(maximum, value);
+    sum += value;
+    nonZeroSteps += (value != 0.0) ? 1.0 : 0.0;
+  }
+
+  double hoursPerStep = minutesPerStep / 60.0;
+
+  result.minimum = minimum;
+  result.maximum = maximum;
+  result.mean = sum / values.size();
+  result.fullLoadHours = sum * hoursPerStep;
+  result.equivalentFullLoadHours = (maximum > 0.0) ? result.fullLoadHours / maximum : 0.0;
+  result.nonZeroHours = nonZeroSteps * hoursPerStep;
+
+  return result;
+}
+
+static bool operator==(const ScheduleDayData & lhs, const ScheduleDayData & rhs)
+{
+  return (lhs.untilHours == rhs.untilHours) && (lhs.values == rhs.values) && (lhs.interpolate == rhs.interpolate);
+}
+
+static bool operator==(const ScheduleRuleData & lhs, const ScheduleRuleData & rhs)
+{
+  return (lhs.dateRange == rhs.dateRange) &&
+         (lhs.startDay == rhs.startDay) &&
+         (lhs.endDay == rhs.endDay) &&
+         (lhs.specificDays == rhs.specificDays) &&
+         std::equal(lhs.applyDayOfWeek, lhs.applyDayOfWeek + 7, rhs.applyDayOfWeek);
+}
+
+static bool operator==(const ScheduleRulesetData & lhs, const ScheduleRulesetData & rhs)
+{
+  return (lhs.handle == rhs.handle) &&
+         (lhs.numberOfDays == rhs.numberOfDays) &&
+         (lhs.firstDayOfWeek == rhs.firstDayOfWeek) &&
+         (lhs.rules == rhs.rules) &&
+         (lhs.days == rhs.days);
+}
+
+ScheduleEvaluation evaluateScheduleRuleset(const ScheduleRulesetData & data)
+{
+  ScheduleEvaluation result;
+
+  result.handle = data.handle;
+
+  result.activeRuleIndices = activeRuleIndices(data);
+
+  result.statistics = scheduleStatistics(hourlyValues(data, result.activeRuleIndices), 60);
+
+  return result;
+}
+
+ScheduleEvaluator::ScheduleEvaluator(const model::Model & model, QObject * parent)
+  : QObject(parent),
+    m_model(model),
+    m_invalidateAll(false)
+{
+  connect(&m_watcher, &QFutureWatcher<ScheduleEvaluation>::resultReadyAt, this, &ScheduleEvaluator::onResultReadyAt);
+
+  connect(&m_watcher, &QFutureWatcher<ScheduleEvaluation>::finished, this, &ScheduleEvaluator::startQueued);
+
+  // A rule added to a ruleset does not change the ruleset itself
+  connect(OSAppBase::instance(), &OSAppBase::workspaceObjectAddedPtr, this, &ScheduleEvaluator::onModelObjectAdded, Qt::QueuedConnection);
+
+  model::YearDescription yearDescription = m_model.getUniqueModelObject<model::YearDescription>();
+
+  yearDescription.getImpl<model::detail::YearDescription_Impl>().get()->onChange.connect<ScheduleEvaluator, &ScheduleEvaluator::onYearDescriptionChange>(this);
+}
+
+ScheduleEvaluator::~ScheduleEvaluator()
+{
+  m_watcher.cancel();
+
+  m_watcher.waitForFinished();
+}
+
+ScheduleEvaluator::Entry & ScheduleEvaluator::entry(const model::ScheduleRuleset & scheduleRuleset)
+{
+  auto it = m_entries.find(scheduleRuleset.handle());
+
+  if( it == m_entries.end() )
+  {
+    it = m_entries.insert(std::make_pair(scheduleRuleset.handle(), Entry())).first;
+  }
+
+  return it->second;
+}
+
+ScheduleEvaluator::Entry & ScheduleEvaluator::usedEntry(const model::ScheduleRuleset & scheduleRuleset)
+{
+  Entry & result = entry(scheduleRuleset);
+
+  if( ! result.observer )
+  {
+    result.observer = std::make_shared<ScheduleRulesetObserver>(this, scheduleRuleset);
+
+    // Nothing was watching the ruleset while it was evaluated, results from data that changed since are dropped
+    if( (result.hasStatistics || result.pending) && ! (result.data == scheduleRulesetData(scheduleRuleset)) )
+    {
+      std::shared_ptr<ScheduleRulesetObserver> observer = result.observer;
+
+      dropPending(scheduleRuleset.handle());
+
+      result = Entry();
+
+      result.observer = observer;
+    }
+
+    result.data = ScheduleRulesetData();
+  }
+
+  return result;
+}
+
+const std::vector<int> & ScheduleEvaluator::activeRuleIndices(const model::ScheduleRuleset & scheduleRuleset)
+{
+  Entry & result = usedEntry(scheduleRuleset);
+
+  if( ! result.hasActiveRuleIndices )
+  {
+    result.activeRuleIndices = openstudio::activeRuleIndices(scheduleRulesetData(scheduleRuleset));
+
+    result.hasActiveRuleIndices = true;
+  }
+
+  return result.activeRuleIndices;
+}
+
+const ScheduleStatistics & ScheduleEvaluator::statistics(const model::ScheduleRuleset & scheduleRuleset)
+{
+  Entry & result = usedEntry(scheduleRuleset);
+
+  if( ! result.hasStatistics )
+  {
+    dropPending(scheduleRuleset.handle());
+
+    store(result, evaluateScheduleRuleset(scheduleRulesetData(scheduleRuleset)));
+  }
+
+  return result.statistics;
+}
+
+std::vector<double> ScheduleEvaluator::hourlyValues(const model::ScheduleRuleset & scheduleRuleset)
+{
+  return annualValues(scheduleRuleset, 60);
+}
+
+std::vector<double> ScheduleEvaluator::annualValues(const model::ScheduleRuleset & scheduleRuleset, int minutesPerStep)
+{
+  const std::vector<int> & indices = activeRuleIndices(scheduleRuleset);
+
+  return openstudio::annualValues(scheduleRulesetData(scheduleRuleset), indices, minutesPerStep);
+}
+
+bool ScheduleEvaluator::hasStatistics(const Handle & handle) const
+{
+  auto it = m_entries.find(handle);
+
+  return (it != m_entries.end()) && it->second.hasStatistics;
+}
+
+void ScheduleEvaluator::store(Entry & entry, ScheduleEvaluation && evaluation)
+{
+  entry.activeRuleIndices = std::move(evaluation.activeRuleIndices);
+
+  entry.hasActiveRuleIndices = true;
+
+  entry.statistics = evaluation.statistics;
+
+  entry.hasStatistics = true;
+
+  entry.pending = false;
+}
+
+void ScheduleEvaluator::evaluate(const std::vector<model::ScheduleRuleset> & scheduleRulesets)
+{
+  // Only the rulesets new to this call are copied, pending ones keep their place
+  for( const auto & scheduleRuleset : scheduleRulesets )
+  {
+    Entry & scheduleEntry = entry(scheduleRuleset);
+
+    if( ! scheduleEntry.hasStatistics && ! scheduleEntry.pending )
+    {
+      scheduleEntry.pending = true;
+
+      ScheduleRulesetData rulesetData = scheduleRulesetData(scheduleRuleset);
+
+      if( ! scheduleEntry.observer )
+      {
+        scheduleEntry.data = rulesetData;
+      }
+
+      m_queued.push_back(std::move(rulesetData));
+    }
+  }
+
+  startQueued();
+}
+
+void ScheduleEvaluator::startQueued()
+{
+  // The next batch waits until every result still wanted from the running one is in
+  if( ! m_running.empty() || m_queued.empty() )
+  {
+    return;
+  }
+
+  for( const auto & rulesetData : m_queued )
+  {
+    m_running.insert(rulesetData.handle);
+  }
+
+  QList<ScheduleRulesetData> data;
+
+  for( auto & rulesetData : m_queued )
+  {
+    data.append(std::move(rulesetData));
+  }
+
+  m_queued.clear();
+
+  m_watcher.setFuture(QtConcurrent::mapped(data, evaluateScheduleRuleset));
+}
+
+void ScheduleEvaluator::onResultReadyAt(int index)
+{
+  ScheduleEvaluation evaluation = m_watcher.resultAt(index);
+
+  // Dropped or worked out on the gui thread while it ran
+  if( m_running.erase(evaluation.handle) == 0 )
+  {
+    return;
+  }
+
+  auto it = m_entries.find(evaluation.handle);
+
+  if( (it == m_entries.end()) || ! it->second.pending )
+  {
+    return;
+  }
+
+  Handle handle = evaluation.handle;
+
+  store(it->second, std::move(evaluation));
+
+  emit statisticsReady(handle);
+}
+
+void ScheduleEvaluator::dropPending(const Handle & handle)
+{
+  m_running.erase(handle);
+
+  m_queued.erase(std::remove_if(m_queued.begin(), m_queued.end(), [&handle](const ScheduleRulesetData & rulesetData) {
+    return rulesetData.handle == handle;
+  }), m_queued.end());
+}
+
+void ScheduleEvaluator::invalidateLater(const Handle & handle)
+{
+  if( m_invalidHandles.empty() && ! m_invalidateAll )
+  {
+    QTimer::singleShot(0, this, SLOT(invalidateNow()));
+  }
+
+  m_invalidHandles.insert(handle);
+}
+
+void ScheduleEvaluator::onYearDescriptionChange()
+{
+  if( m_invalidHandles.empty() && ! m_invalidateAll )
+  {
+    QTimer::singleShot(0, this, SLOT(invalidateNow()));
+  }
+
+  m_invalidateAll = true;
+}
+
+void ScheduleEvaluator::invalidateNow()
+{
+  if( m_invalidateAll )
+  {
+    m_entries.clear();
+
+    m_running.clear();
+
+    m_queued.clear();
+
+    emit invalidated(Handle());
+  }
+  else
+  {
+    for( const auto & handle : m_invalidHandles )
+    {
+      m_entries.erase(handle);
+
+      dropPending(handle);
+
+      emit invalidated(handle);
+    }
+  }
+
+  m_invalidHandles.clear();
+
+  m_invalidateAll = false;
+}
+
+void ScheduleEvaluator::onModelObjectAdded(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> wPtr, const openstudio::IddObjectType& type, const openstudio::UUID& uuid)
+{
+  if( boost::optional<model::ScheduleRule> scheduleRule = m_model.getModelObject<model::ScheduleRule>(uuid) )
+  {
+    Handle handle = scheduleRule->scheduleRuleset().handle();
+
+    if( m_entries.find(handle) != m_entries.end() )
+    {
+      invalidateLater(handle);
+    }
+  }
+}
+
+} // openstudio
@@ -0,0 +1,244 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+
+#ifndef OPENSTUDIO_SCHEDULEEVALUATION_HPP
+#define OPENSTUDIO_SCHEDULEEVALUATION_HPP
+
+#include "../model_editor/QMetaTypes.hpp"
+
+#include <openstudio/model/Model.hpp>
+#include <openstudio/model/ScheduleRuleset.hpp>
+#include <openstudio/nano/nano_signal_slot.hpp> // Signal-Slot replacement
+
+#include <QFutureWatcher>
+#include <QObject>
+
+#include <map>
+#include <memory>
+#include <set>
+#include <vector>
+
+namespace openstudio {
+
+// Plain copy of a ScheduleDay, the value of interval i applies until untilHours[i] (hours since midnight)
+struct ScheduleDayData
+{
+  std::vector<double> untilHours;
+
+  std::vector<double> values;
+
+  bool interpolate = false;
+};
+
+// Plain copy of the dates and week days of a ScheduleRule
+struct ScheduleRuleData
+{
+  bool dateRange = true;
+
+  // days of the year, 1 based, the range wraps around the new year if the start is after the end
+  int startDay = 0;
+
+  int endDay = 0;
+
+  std::vector<int> specificDays;
+
+  // Sunday first
+  bool applyDayOfWeek[7] = {false, false, false, false, false, false, false};
+};
+
+// What it takes to evaluate a ScheduleRuleset. It is copied from the model on the gui thread, after which it can be
+// evaluated on any thread.
+struct ScheduleRulesetData
+{
+  Handle handle;
+
+  int numberOfDays = 365;
+
+  // day of the week of January 1st of the assumed year, Sunday is 0
+  int firstDayOfWeek = 0;
+
+  // in priority order
+  std::vector<ScheduleRuleData> rules;
+
+  // the default day first, then the day of each rule
+  std::vector<ScheduleDayData> days;
+};
+
+// Annual figures of a schedule, in the units of the schedule values
+struct ScheduleStatistics
+{
+  double minimum = 0.0;
+
+  double maximum = 0.0;
+
+  double mean = 0.0;
+
+  // sum of value times hours, the hours at full load for a fractional schedule
+  double fullLoadHours = 0.0;
+
+  // fullLoadHours over the maximum value, 0 when the maximum is not positive
+  double equivalentFullLoadHours = 0.0;
+
+  double nonZeroHours = 0.0;
+};
+
+// Results for one ScheduleRuleset
+struct ScheduleEvaluation
+{
+  Handle handle;
+
+  // rule applying on each day of the year, -1 where the default day applies
+  std::vector<int> activeRuleIndices;
+
+  // of the average value over each hour of the year
+  ScheduleStatistics statistics;
+};
+
+ScheduleRulesetData scheduleRulesetData(const model::ScheduleRuleset & scheduleRuleset);
+
+// Same as ScheduleRuleset::getActiveRuleIndices over the assumed year
+std::vector<int> activeRuleIndices(const ScheduleRulesetData & data);
+
+// Average value over each step of the year, day after day in one contiguous array. minutesPerStep is between 1 and 60
+// and divides the hour, as the EnergyPlus timestep does.
+std::vector<double> annualValues(const ScheduleRulesetData & data, const std::vector<int> & activeRuleIndices, int minutesPerStep);
+
+std::vector<double> hourlyValues(const ScheduleRulesetData & data, const std::vector<int> & activeRuleIndices);
+
+ScheduleStatistics scheduleStatistics(const std::vector<double> & values, int minutesPerStep);
+
+ScheduleEvaluation evaluateScheduleRuleset(const ScheduleRulesetData & data);
+
+class ScheduleRulesetObserver;
+
+// Day to rule mapping and statistics of the ScheduleRulesets of a model. Results are computed on first use or by
+// evaluate() and kept until the ruleset, its rules, their day schedules or the year description change. A ruleset is
+// only observed once its results are first asked for. Hourly and finer values take 70 kB a ruleset, they are worked
+// out again from the kept mapping each time they are asked for.
+class ScheduleEvaluator : public QObject, public Nano::Observer
+{
+  Q_OBJECT
+
+ public:
+
+  explicit ScheduleEvaluator(const model::Model & model, QObject * parent = nullptr);
+
+  virtual ~ScheduleEvaluator();
+
+  const std::vector<int> & activeRuleIndices(const model::ScheduleRuleset & scheduleRuleset);
+
+  const ScheduleStatistics & statistics(const model::ScheduleRuleset & scheduleRuleset);
+
+  std::vector<double> hourlyValues(const model::ScheduleRuleset & scheduleRuleset);
+
+  std::vector<double> annualValues(const model::ScheduleRuleset & scheduleRuleset, int minutesPerStep);
+
+  bool hasStatistics(const Handle & handle) const;
+
+  // Evaluates the rulesets that are not cached or pending yet on worker threads, statisticsReady is emitted for each
+  // one. Rulesets asked for while a batch runs are started together once it is done.
+  void evaluate(const std::vector<model::ScheduleRuleset> & scheduleRulesets);
+
+ signals:
+
+  void statisticsReady(const openstudio::UUID & handle);
+
+  // The results for the ruleset were dropped, a null handle stands for all of them
+  void invalidated(const openstudio::UUID & handle);
+
+ private slots:
+
+  void onResultReadyAt(int index);
+
+  void startQueued();
+
+  void invalidateNow();
+
+  void onModelObjectAdded(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> wPtr, const openstudio::IddObjectType& type, const openstudio::UUID& uuid);
+
+ private:
+
+  friend class ScheduleRulesetObserver;
+
+  struct Entry
+  {
+    std::vector<int> activeRuleIndices;
+
+    ScheduleStatistics statistics;
+
+    bool hasActiveRuleIndices = false;
+
+    bool hasStatistics = false;
+
+    // waiting for a background evaluation
+    bool pending = false;
+
+    // what the background evaluation was started from, checked against the model when the entry is first used
+    ScheduleRulesetData data;
+
+    // null until the entry is first used
+    std::shared_ptr<ScheduleRulesetObserver> observer;
+  };
+
+  Entry & entry(const model::ScheduleRuleset & scheduleRuleset);
+
+  // The entry of a ruleset whose results are about to be read, observed from now on
+  Entry & usedEntry(const model::ScheduleRuleset & scheduleRuleset);
+
+  void store(Entry & entry, ScheduleEvaluation && evaluation);
+
+  // The ruleset is not waited for anymore, its result is ignored if it comes back
+  void dropPending(const Handle & handle);
+
+  // Rules fire a change for each field that is set, the results are dropped once control returns to the event loop
+  void invalidateLater(const Handle & handle);
+
+  void onYearDescriptionChange();
+
+  model::Model m_model;
+
+  std::map<Handle, Entry> m_entries;
+
+  std::set<Handle> m_invalidHandles;
+
+  bool m_invalidateAll;
+
+  // rulesets of the batch running on m_watcher whose results are still wanted
+  std::set<Handle> m_running;
+
+  // waiting for the running batch to finish
+  std::vector<ScheduleRulesetData> m_queued;
+
+  QFutureWatcher<ScheduleEvaluation> m_watcher;
+};
+
+} // openstudio
+
+#endif // OPENSTUDIO_SCHEDULEEVALUATION_HPP
@@ -29,6 +29,7 @@
 
 #include "SchedulesView.hpp"
 #include "ScheduleDayView.hpp"
+#include "ScheduleEvaluation.hpp"
 #include "OSAppBase.hpp"
 
 #include "../shared_gui_components/OSCheckBox.hpp"
@@ -79,6 +80,7 @@
 #include <QVBoxLayout>
 #include <algorithm>
 #include <iterator>
+#include <sstream>
 
 #include <openstudio/utilities/idd/IddEnums.hxx>
 
@@ -114,6 +116,7 @@ std::vector<QColor> SchedulesView::initializeColors()
 SchedulesView::SchedulesView(bool isIP, const model::Model & model)
   : QWidget(),
     m_model(model),
+    m_scheduleEvaluator(new ScheduleEvaluator(model, this)),
     m_leftVLayout(nullptr),
     m_contentLayout(nullptr),
     m_isIP(isIP)
@@ -191,56 +194,49 @@ SchedulesView::SchedulesView(bool isIP, const model::Model & model)
 
   showEmptyPage();
 
+  // Tabs are only headers until expanded, their rules are shown by the content built then
   for (auto it = schedules.begin();
        it < schedules.end();
        ++it)
   {
     addSchedule(*it);
-
-    std::vector<model::ScheduleRule> rules = it->scheduleRules();
-
-    for (auto ruleIt = rules.begin();
-         ruleIt < rules.end();
-         ++ruleIt)
-    {
-      addScheduleRule(*ruleIt);
-    }
   }
 
-  updateRowColors();
-
+  // Statistics are evaluated for the expanded schedule only, when its content is shown
   if (!schedules.empty()){
     setCurrentSchedule(schedules.back());
   }
+}
 
+ScheduleEvaluator * SchedulesView::scheduleEvaluator() const
+{
+  return m_scheduleEvaluator;
 }
 
 void SchedulesView::closeAllTabs() const
 {
-  for (int i = 0; i < m_leftVLayout->count() - 1; i++)
+  if (m_currentTab)
   {
-    ScheduleTab * scheduleTab = qobject_cast<ScheduleTab *>(m_leftVLayout->itemAt(i)->widget());
-
-    scheduleTab->scheduleTabContent()->hide();
+    if (ScheduleTabContent * scheduleTabContent = m_currentTab->scheduleTabContent())
+    {
+      scheduleTabContent->hide();
+    }
   }
 }
 
 ScheduleTab * SchedulesView::tabForSchedule(const model::ScheduleRuleset schedule) const
 {
-  for (int i = 0; i < m_leftVLayout->count() - 1; i++)
-  {
-    ScheduleTab * scheduleTab = qobject_cast<ScheduleTab *>(m_leftVLayout->itemAt(i)->widget());
+  auto it = m_scheduleTabs.find(schedule.handle());
 
-    if (scheduleTab->schedule().handle() == schedule.handle())
-    {
-      return scheduleTab;
-    }
+  if (it != m_scheduleTabs.end())
+  {
+    return it->second;
   }
 
   return nullptr;
 }
 
-void SchedulesView::updateRowColors()
+void SchedulesView::updateRowColors(int count)
 {
   QString evenStyle;
   evenStyle.append("QWidget#ThermalZoneTab {");
@@ -256,11 +252,14 @@ void SchedulesView::updateRowColors()
   oddStyle.append("}");
   oddStyle.append("QWidget#SideBar {background: #CECECE;}");
 
-  for (int i = 0; i < m_leftVLayout->count() - 1; i++)
+  // the last item of the layout is the stretch
+  int numberOfTabs = m_leftVLayout->count() - 1;
+
+  for (int i = 0; i < std::min(count, numberOfTabs); i++)
   {
     ScheduleTab * scheduleTab = qobject_cast<ScheduleTab *>(m_leftVLayout->itemAt(i)->widget());
 
-    if (i % 2 == 0)
+    if ((numberOfTabs - 1 - i) % 2 == 0)
     {
       scheduleTab->setStyleSheet(evenStyle);
     } else
@@ -275,6 +274,9 @@ void SchedulesView::addSchedule(model::ScheduleRuleset & schedule)
   auto scheduleTab = new ScheduleTab(schedule, this);
   connect(scheduleTab, &ScheduleTab::scheduleClicked, this, &SchedulesView::setCurrentSchedule);
   m_leftVLayout->insertWidget(0, scheduleTab);
+  m_scheduleTabs[schedule.handle()] = scheduleTab;
+
+  updateRowColors(1);
 }
 
 void SchedulesView::addScheduleRule(model::ScheduleRule & rule)
@@ -283,11 +285,10 @@ void SchedulesView::addScheduleRule(model::ScheduleRule & rule)
 
   ScheduleTab * tab = tabForSchedule(scheduleRuleset);
 
-  if (tab)
+  // A collapsed tab shows the rule once it is expanded
+  if (tab && tab->scheduleTabContent())
   {
     tab->scheduleTabContent()->scheduleRefresh(scheduleRuleset.handle()); // Handle as dummy
-
-    rule.getImpl<model::detail::ScheduleRule_Impl>().get()->onRemoveFromWorkspace.connect<ScheduleTabContent, &ScheduleTabContent::scheduleRefresh>(tab->scheduleTabContent());
   }
 
 }
@@ -322,21 +323,22 @@ void SchedulesView::onModelObjectRemoved(std::shared_ptr<openstudio::detail::Wor
 
     bool wasSelected = false;
 
-    ScheduleTab * scheduleTab = nullptr;
+    auto it = m_scheduleTabs.find(workspaceObjectImpl->handle());
 
-    for (int i = 0;
-         i < m_leftVLayout->count() - 1;
-         i++)
+    if (it != m_scheduleTabs.end())
     {
-      scheduleTab = qobject_cast<ScheduleTab *>(m_leftVLayout->itemAt(i)->widget());
-      if (scheduleTab->schedule().handle() == workspaceObjectImpl->handle())
-      {
-        m_leftVLayout->removeWidget(scheduleTab);
-        wasSelected = scheduleTab->selected();
-        removedIndex = i;
-        delete scheduleTab;
-        break;
-      }
+      ScheduleTab * scheduleTab = it->second;
+      removedIndex = m_leftVLayout->indexOf(scheduleTab);
+      m_leftVLayout->removeWidget(scheduleTab);
+      m_scheduleTabs.erase(it);
+      wasSelected = scheduleTab->selected();
+      delete scheduleTab;
+    }
+
+    // Only the rows above the removed one change stripe
+    if (removedIndex > 0)
+    {
+      updateRowColors(removedIndex);
     }
 
     if (wasSelected)
@@ -371,36 +373,35 @@ void SchedulesView::onModelObjectRemoved(std::shared_ptr<openstudio::detail::Wor
 
 void SchedulesView::setCurrentSchedule(const model::ScheduleRuleset & schedule)
 {
-  this->updateRowColors();
+  ScheduleTab * scheduleTab = tabForSchedule(schedule);
 
-  for (int i = 0;
-       i < m_leftVLayout->count() - 1;
-       i++)
+  // Only the previous and the new selection change
+  if (m_currentTab && (m_currentTab != scheduleTab))
   {
-    ScheduleTab * scheduleTab;
+    m_currentTab->setSelected(false);
 
-    scheduleTab = qobject_cast<ScheduleTab *>(m_leftVLayout->itemAt(i)->widget());
+    m_currentTab->collapse();
 
-    if (scheduleTab->schedule() == schedule)
-    {
-      if (!scheduleTab->selected())
-      {
-        scheduleTab->setSelected(true);
+    m_currentTab->update();
+  }
 
-        scheduleTab->expand();
-      } else
-      {
-        scheduleTab->toggle();
-      }
-    } else {
-      scheduleTab->setSelected(false);
+  if (scheduleTab)
+  {
+    if (!scheduleTab->selected())
+    {
+      scheduleTab->setSelected(true);
 
-      scheduleTab->collapse();
+      scheduleTab->expand();
+    } else
+    {
+      scheduleTab->toggle();
     }
 
     scheduleTab->update();
   }
 
+  m_currentTab = scheduleTab;
+
   //showScheduleRuleset(schedule);
 
   // DLM: I don't think that the code below works because it gets called when the scene is not visible
@@ -641,21 +642,12 @@ void SchedulesView::showEmptyPage()
 
 boost::optional<model::ScheduleRuleset> SchedulesView::currentSchedule()
 {
-  for (int i = 0;
-       i < m_leftVLayout->count() - 1;
-       i++)
+  if (m_currentTab && m_currentTab->selected())
   {
-    ScheduleTab * scheduleTab;
-
-    scheduleTab = qobject_cast<ScheduleTab *>(m_leftVLayout->itemAt(i)->widget());
-
-    if (scheduleTab->selected())
+    if (boost::optional<model::ScheduleRuleset> schedule = m_currentTab->schedule())
     {
-      if (boost::optional<model::ScheduleRuleset> schedule = scheduleTab->schedule())
-      {
-        if (!schedule->handle().isNull()) {
-          return schedule;
-        }
+      if (!schedule->handle().isNull()) {
+        return schedule;
       }
     }
   }
@@ -691,6 +683,7 @@ ScheduleTab::ScheduleTab(const model::ScheduleRuleset & schedule, SchedulesView
   : QWidget(parent),
   //m_mouseDown(false),
   m_selected(false),
+  m_content(nullptr),
   m_schedule(schedule),
   m_schedulesView(schedulesView)
 {
@@ -708,9 +701,7 @@ ScheduleTab::ScheduleTab(const model::ScheduleRuleset & schedule, SchedulesView
   line1->setFixedHeight(1);
   mainVLayout->addWidget(line1);
 
-  m_content = new ScheduleTabContent(this);
-  mainVLayout->addWidget(m_content);
-  m_content->setVisible(false);
+  // m_content is built on expand, a long list of schedules is mostly headers
 
   auto line2 = new QFrame();
   line2->setFrameShape(QFrame::HLine);
@@ -720,6 +711,14 @@ ScheduleTab::ScheduleTab(const model::ScheduleRuleset & schedule, SchedulesView
 
 void ScheduleTab::expand()
 {
+  if (!m_content)
+  {
+    m_content = new ScheduleTabContent(this);
+
+    // between the two lines
+    qobject_cast<QVBoxLayout *>(layout())->insertWidget(2, m_content);
+  }
+
   m_content->show();
 
   m_header->expand();
@@ -727,16 +726,27 @@ void ScheduleTab::expand()
 
 void ScheduleTab::collapse()
 {
-  m_content->hide();
+  if (m_content)
+  {
+    m_content->hide();
+
+    m_content->deleteLater();
+
+    m_content = nullptr;
+  }
 
   m_header->collapse();
 }
 
 void ScheduleTab::toggle()
 {
-  m_header->toggle();
-
-  m_content->setVisible(!m_content->isVisible());
+  if (m_content && m_content->isVisible())
+  {
+    collapse();
+  } else
+  {
+    expand();
+  }
 }
 
 ScheduleTabHeader * ScheduleTab::scheduleTabHeader() const
@@ -973,13 +983,26 @@ void ScheduleTabHeader::paintEvent(QPaintEvent * event)
 
 ScheduleTabContent::ScheduleTabContent(ScheduleTab * scheduleTab, QWidget * parent)
   : QWidget(parent),
-  m_scheduleTab(scheduleTab)
+  m_scheduleTab(scheduleTab),
+  m_mouseDown(false),
+  m_dirty(true),
+  m_statisticsDirty(true)
 {
   auto mainVLayout = new QVBoxLayout();
   mainVLayout->setContentsMargins(5, 5, 5, 5);
   mainVLayout->setSpacing(5);
   setLayout(mainVLayout);
 
+  m_statisticsLabel = new QLabel();
+  m_statisticsLabel->setWordWrap(true);
+  m_statisticsLabel->setStyleSheet("QLabel { color: #505050; font-size: 11px; }");
+  mainVLayout->addWidget(m_statisticsLabel);
+
+  ScheduleEvaluator * scheduleEvaluator = m_scheduleTab->schedulesView()->scheduleEvaluator();
+  connect(scheduleEvaluator, &ScheduleEvaluator::statisticsReady, this, &ScheduleTabContent::onEvaluationChanged);
+  connect(scheduleEvaluator, &ScheduleEvaluator::invalidated, this, &ScheduleTabContent::onEvaluationChanged);
+  connect(m_scheduleTab->schedulesView(), &SchedulesView::toggleUnitsClicked, this, &ScheduleTabContent::onToggleUnitsClicked);
+
   QLabel * specialDayLabel = new QLabel("Special Day Profiles");
   mainVLayout->addWidget(specialDayLabel);
 
@@ -1041,6 +1064,8 @@ ScheduleTabContent::ScheduleTabContent(ScheduleTab * scheduleTab, QWidget * pare
 
   auto defaultTab = new ScheduleTabDefault(m_scheduleTab, ScheduleTabDefault::DEFAULT);
   defaultLayout->addWidget(defaultTab);
+
+  refresh();
 }
 
 void ScheduleTabContent::refresh()
@@ -1078,6 +1103,97 @@ void ScheduleTabContent::scheduleRefresh(const Handle& handle)
   QTimer::singleShot(0, this, SLOT(refresh()));
 }
 
+void ScheduleTabContent::showEvent(QShowEvent * event)
+{
+  QWidget::showEvent(event);
+
+  refreshStatistics();
+}
+
+void ScheduleTabContent::onEvaluationChanged(const openstudio::UUID & handle)
+{
+  if (handle.isNull() || (handle == m_scheduleTab->schedule().handle()))
+  {
+    m_statisticsDirty = true;
+
+    refreshStatistics();
+  }
+}
+
+void ScheduleTabContent::onToggleUnitsClicked(bool displayIP)
+{
+  m_statisticsDirty = true;
+
+  refreshStatistics();
+}
+
+void ScheduleTabContent::refreshStatistics()
+{
+  if (!m_statisticsDirty || !isVisible())
+  {
+    return;
+  }
+
+  model::ScheduleRuleset scheduleRuleset = m_scheduleTab->schedule();
+
+  ScheduleEvaluator * scheduleEvaluator = m_scheduleTab->schedulesView()->scheduleEvaluator();
+
+  // Evaluated in the background, statisticsReady comes back here
+  if (!scheduleEvaluator->hasStatistics(scheduleRuleset.handle()))
+  {
+    m_statisticsLabel->setText("Annual statistics: evaluating...");
+
+    scheduleEvaluator->evaluate(std::vector<model::ScheduleRuleset>{ scheduleRuleset });
+
+    return;
+  }
+
+  const ScheduleStatistics & statistics = scheduleEvaluator->statistics(scheduleRuleset);
+
+  double minimum = statistics.minimum;
+  double maximum = statistics.maximum;
+  QString units;
+
+  if (boost::optional<model::ScheduleTypeLimits> scheduleTypeLimits = scheduleRuleset.scheduleTypeLimits())
+  {
+    bool isIP = m_scheduleTab->schedulesView()->isIP();
+
+    boost::optional<Unit> siUnits = scheduleTypeLimits->units(false);
+    boost::optional<Unit> toUnits = scheduleTypeLimits->units(isIP);
+
+    if (siUnits && toUnits && isIP && (siUnits.get() != toUnits.get()))
+    {
+      OptionalQuantity minimumQuantity = openstudio::convert(Quantity(minimum, siUnits.get()), toUnits.get());
+      OptionalQuantity maximumQuantity = openstudio::convert(Quantity(maximum, siUnits.get()), toUnits.get());
+      OS_ASSERT(minimumQuantity && maximumQuantity);
+      minimum = minimumQuantity->value();
+      maximum = maximumQuantity->value();
+    }
+
+    if (toUnits)
+    {
+      std::stringstream ss;
+      ss << toUnits.get();
+      units = QString::fromStdString(ss.str());
+    }
+  }
+
+  QString text = QString("Annual full load hours: %1, equivalent full load hours: %2, min: %3, max: %4")
+    .arg(statistics.fullLoadHours, 0, 'f', 0)
+    .arg(statistics.equivalentFullLoadHours, 0, 'f', 0)
+    .arg(minimum, 0, 'g', 4)
+    .arg(maximum, 0, 'g', 4);
+
+  if (!units.isEmpty())
+  {
+    text.append(" " + units);
+  }
+
+  m_statisticsLabel->setText(text);
+
+  m_statisticsDirty = false;
+}
+
 void ScheduleTabContent::onScheduleRuleClicked()
 {
   emit scheduleRuleClicked(scheduleTab()->schedule());
@@ -1129,9 +1245,19 @@ ScheduleTabRule::ScheduleTabRule(ScheduleTab * scheduleTab,
 
   m_scheduleRule.getImpl<model::detail::ScheduleRule_Impl>().get()->onChange.connect<ScheduleTabRule, &ScheduleTabRule::scheduleRefresh>(this);
 
+  m_scheduleRule.getImpl<model::detail::ScheduleRule_Impl>().get()->onRemoveFromWorkspace.connect<ScheduleTabRule, &ScheduleTabRule::onRemoveFromWorkspace>(this);
+
   setMouseTracking(true);
 }
 
+void ScheduleTabRule::onRemoveFromWorkspace(const Handle & handle)
+{
+  if (ScheduleTabContent * scheduleTabContent = m_scheduleTab->scheduleTabContent())
+  {
+    scheduleTabContent->scheduleRefresh(handle);
+  }
+}
+
 void ScheduleTabRule::refresh()
 {
   if (m_dirty)
@@ -1598,7 +1724,7 @@ DefaultScheduleDayView::DefaultScheduleDayView(bool isIP,
   vLine2->setFixedWidth(2);
   mainHLayout->addWidget(vLine2);
 
-  auto yearOverview = new YearOverview(scheduleRuleset);
+  auto yearOverview = new YearOverview(scheduleRuleset, schedulesView->scheduleEvaluator());
   mainHLayout->addWidget(yearOverview);
 }
 
@@ -1905,7 +2031,7 @@ ScheduleRuleView::ScheduleRuleView(bool isIP,
   vLine2->setFixedWidth(2);
   mainHLayout->addWidget(vLine2);
 
-  YearOverview * yearOverview = new YearOverview(m_scheduleRule.scheduleRuleset());
+  YearOverview * yearOverview = new YearOverview(m_scheduleRule.scheduleRuleset(), m_schedulesView->scheduleEvaluator());
   mainHLayout->addWidget(yearOverview);
 
   // Connect
@@ -2069,9 +2195,10 @@ ScheduleRulesetNameWidget::ScheduleRulesetNameWidget(const model::ScheduleRulese
 // YearOverview
 /******************************************************************************/
 
-YearOverview::YearOverview(const model::ScheduleRuleset & scheduleRuleset, QWidget * parent)
+YearOverview::YearOverview(const model::ScheduleRuleset & scheduleRuleset, ScheduleEvaluator * scheduleEvaluator, QWidget * parent)
   : QWidget(parent),
   m_scheduleRuleset(scheduleRuleset),
+  m_scheduleEvaluator(scheduleEvaluator),
   m_dirty(false)
 {
   refreshActiveRuleIndices();
@@ -2155,54 +2282,28 @@ YearOverview::YearOverview(const model::ScheduleRuleset & scheduleRuleset, QWidg
 
   mainLayout->addStretch(10);
 
-  //m_scheduleRuleset.model().getImpl<model::detail::Model_Impl>().get()->addWorkspaceObjectPtr.connect<YearOverview, &YearOverview::onModelAdd>(this);
-  connect(OSAppBase::instance(), &OSAppBase::workspaceObjectAddedPtr, this, &YearOverview::onModelAdd, Qt::QueuedConnection);
-
-
-  std::vector<model::ScheduleRule> scheduleRules = m_scheduleRuleset.scheduleRules();
-
-  for (auto it = scheduleRules.begin();
-       it < scheduleRules.end();
-       ++it)
-  {
-    it->getImpl<model::detail::ScheduleRule_Impl>().get()->onChange.connect<YearOverview, &YearOverview::scheduleRefresh>(this);
-  }
-
-  model::YearDescription yearDescription = m_scheduleRuleset.model().getUniqueModelObject<model::YearDescription>();
-
-  yearDescription.getImpl<model::detail::YearDescription_Impl>().get()->onChange.connect<YearOverview, &YearOverview::scheduleRefresh>(this);
+  // The evaluator watches the rules, their days and the year description
+  connect(m_scheduleEvaluator, &ScheduleEvaluator::invalidated, this, &YearOverview::onEvaluationInvalidated);
 
   refresh();
 }
 
 void YearOverview::refreshActiveRuleIndices()
 {
-  int year = m_scheduleRuleset.model().getUniqueModelObject<model::YearDescription>().assumedYear();
-
-  Date startDate(1, 1, year);
-  Date endDate(12, 31, year);
-
-  m_activeRuleIndices = m_scheduleRuleset.getActiveRuleIndices(startDate, endDate);
+  m_activeRuleIndices = m_scheduleEvaluator->activeRuleIndices(m_scheduleRuleset);
 
   m_dirty = false;
 }
 
-void YearOverview::onModelAdd(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> wo,
-                              const openstudio::IddObjectType& iddType,
-                              const openstudio::UUID& uuid)
+void YearOverview::onEvaluationInvalidated(const openstudio::UUID & handle)
 {
-  boost::optional<model::ScheduleRule> scheduleRule = m_scheduleRuleset.model().getModelObject<model::ScheduleRule>(wo->handle());
-
-  if (scheduleRule)
+  if (handle.isNull() || (handle == m_scheduleRuleset.handle()))
   {
-    if (scheduleRule->scheduleRuleset().handle() == m_scheduleRuleset.handle())
-    {
-      scheduleRule->getImpl<model::detail::ScheduleRule_Impl>().get()->onChange.connect<YearOverview, &YearOverview::scheduleRefresh>(this);
-    }
+    scheduleRefresh();
   }
 }
 
-std::vector<int> YearOverview::activeRuleIndices() const
+const std::vector<int> & YearOverview::activeRuleIndices() const
 {
   return m_activeRuleIndices;
 }
@@ -2333,7 +2434,9 @@ void ScheduleCalendarWidget::paintCell(QPainter * painter, const QRect & rect, c
   {
     int dayOfYear = date.dayOfYear();
 
-    int ruleIndex = m_monthView->yearOverview()->activeRuleIndices()[dayOfYear - 1];
+    const std::vector<int> & activeRuleIndices = m_monthView->yearOverview()->activeRuleIndices();
+
+    int ruleIndex = (dayOfYear <= static_cast<int>(activeRuleIndices.size())) ? activeRuleIndices[dayOfYear - 1] : -1;
 
     QColor ruleColor = SchedulesView::colors[12];
 
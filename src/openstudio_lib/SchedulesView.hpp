@@ -54,6 +54,7 @@
 #include <QGraphicsItem>
 #include <QGraphicsView>
 #include <openstudio/nano/nano_signal_slot.hpp> // Signal-Slot replacement
+#include <QPointer>
 #include <QWidget>
 
 class QPushButton;
@@ -122,6 +123,8 @@ class MonthView;
 
 class ScheduleCalendarWidget;
 
+class ScheduleEvaluator;
+
 // Overall view for the schedules tab, includes left column selector
 class SchedulesView : public QWidget, public Nano::Observer
 {
@@ -143,6 +146,8 @@ class SchedulesView : public QWidget, public Nano::Observer
 
     void closeAllTabs() const;
 
+    ScheduleEvaluator * scheduleEvaluator() const;
+
   public slots:
 
     void setCurrentSchedule(const model::ScheduleRuleset & schedule);
@@ -224,14 +229,22 @@ class SchedulesView : public QWidget, public Nano::Observer
 
   private:
 
-    void updateRowColors();
+    // Restyles the first count rows, rows are striped counting from the bottom so that a schedule added on top leaves
+    // the others as they are
+    void updateRowColors(int count);
 
     model::Model m_model;
 
+    ScheduleEvaluator * m_scheduleEvaluator;
+
     QVBoxLayout * m_leftVLayout;
 
     QHBoxLayout * m_contentLayout;
 
+    std::map<Handle, ScheduleTab *> m_scheduleTabs;
+
+    QPointer<ScheduleTab> m_currentTab;
+
     bool m_isIP;
 
 };
@@ -261,6 +274,7 @@ public:
 
   ScheduleTabHeader * scheduleTabHeader() const;
 
+  // Only exists while the tab is expanded
   ScheduleTabContent * scheduleTabContent() const;
 
   void expand();
@@ -398,6 +412,10 @@ signals:
 
   void scheduleRefresh(const Handle& handle);
 
+  protected:
+
+  void showEvent(QShowEvent * event) override;
+
   private slots:
 
   void refresh();
@@ -406,17 +424,28 @@ signals:
 
   void onDefaultScheduleClicked();
 
+  void onEvaluationChanged(const openstudio::UUID & handle);
+
+  void onToggleUnitsClicked(bool displayIP);
+
 private:
 
+  // Annual statistics of the schedule, only worked out while the content is shown
+  void refreshStatistics();
+
   ScheduleTab * m_scheduleTab;
 
   QVBoxLayout * m_ruleLayout;
 
+  QLabel * m_statisticsLabel;
+
   std::map<Handle, QPushButton *> m_ruleButtonMap;
 
   bool m_mouseDown;
 
   bool m_dirty;
+
+  bool m_statisticsDirty;
 };
 
 // Inner item in ScheduleTabContent, represents a ScheduleRule
@@ -456,6 +485,8 @@ class ScheduleTabRule : public QWidget, public Nano::Observer
 
   private:
 
+  void onRemoveFromWorkspace(const Handle & handle);
+
   ScheduleTab * m_scheduleTab;
 
   model::ScheduleRule m_scheduleRule;
@@ -723,13 +754,13 @@ class YearOverview : public QWidget, public Nano::Observer
 
   public:
 
-  YearOverview( const model::ScheduleRuleset & scheduleRuleset, QWidget * parent = nullptr );
+  YearOverview( const model::ScheduleRuleset & scheduleRuleset, ScheduleEvaluator * scheduleEvaluator, QWidget * parent = nullptr );
 
   virtual ~YearOverview() {}
 
   model::ScheduleRuleset scheduleRuleset() const;
 
-  std::vector<int> activeRuleIndices() const;
+  const std::vector<int> & activeRuleIndices() const;
 
   private slots:
 
@@ -737,7 +768,7 @@ class YearOverview : public QWidget, public Nano::Observer
 
   void scheduleRefresh();
 
-  void onModelAdd(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl>, const openstudio::IddObjectType&, const openstudio::UUID&);
+  void onEvaluationInvalidated(const openstudio::UUID & handle);
 
   private:
 
@@ -769,6 +800,8 @@ class YearOverview : public QWidget, public Nano::Observer
 
   model::ScheduleRuleset m_scheduleRuleset;
 
+  ScheduleEvaluator * m_scheduleEvaluator;
+
   std::vector<int> m_activeRuleIndices;
 
   bool m_dirty;
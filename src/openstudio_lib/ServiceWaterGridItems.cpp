@@ -45,22 +45,22 @@
 #include <QKeySequence>
 #include <QGraphicsScene>
 #include <QApplication>
+#include <set>
 
 using namespace openstudio::model;
 
 namespace openstudio {
 
 WaterUseConnectionsDetailItem::WaterUseConnectionsDetailItem(WaterUseConnectionsDetailScene * waterUseConnectionsDetailScene)
-  : GridItem()
+  : GridItem(),
+    m_waterUseConnectionsDetailScene(waterUseConnectionsDetailScene),
+    m_leftColumn(0),
+    m_rightColumn(0)
 {
   waterUseConnectionsDetailScene->addItem(this);
 
   model::WaterUseConnections waterUseConnections = waterUseConnectionsDetailScene->waterUseConnections();
 
-  std::vector<model::WaterUseEquipment> waterEquipmentObjects = waterUseConnections.waterUseEquipment();
-
-  int branchCount = waterEquipmentObjects.size();
-
   setHGridLength(12);
 
   setVGridLength(6);
@@ -81,7 +81,9 @@ WaterUseConnectionsDetailItem::WaterUseConnectionsDetailItem(WaterUseConnections
 
   i = i + sewerItem->getHGridLength();
 
-  // Left Vertical
+  // Left Vertical, the part below depends on the branches
+
+  m_leftColumn = i;
 
   auto leftVItem1 = new TwoFourStraightItem(this);
 
@@ -89,40 +91,6 @@ WaterUseConnectionsDetailItem::WaterUseConnectionsDetailItem(WaterUseConnections
 
   leftVItem1->setGridPos(i,j + 1);
 
-  if( branchCount > 0 )
-  {
-    auto leftVItem2 = new OneTwoFourStraightItem(this);
-
-    leftVItem2->setEnableHighlight(false);
-
-    leftVItem2->setGridPos(i,j + 2);
-  }
-  else
-  {
-    auto leftVItem2 = new TwoFourStraightItem(this);
-
-    leftVItem2->setEnableHighlight(false);
-
-    leftVItem2->setGridPos(i,j + 2);
-  }
-
-  if( branchCount > 1 )
-  {
-    auto leftVItem3 = new TwoThreeFourStraightItem(this);
-
-    leftVItem3->setEnableHighlight(false);
-
-    leftVItem3->setGridPos(i,j + 3);
-  }
-  else
-  {
-    auto leftVItem3 = new TwoThreeStraightItem(this);
-
-    leftVItem3->setEnableHighlight(false);
-
-    leftVItem3->setGridPos(i,j + 3);
-  }
-
   // Left top elbow
 
   auto leftTopElbow = new OneFourStraightItem(this);
@@ -177,7 +145,9 @@ WaterUseConnectionsDetailItem::WaterUseConnectionsDetailItem(WaterUseConnections
 
   hotWaterSupplyItem->setGridPos(i + 1,j + 1);
 
-  // Right Vertical
+  // Right Vertical, the part below depends on the branches
+
+  m_rightColumn = i;
 
   auto rightVItem1 = new HotWaterJunctionItem(this);
 
@@ -185,54 +155,141 @@ WaterUseConnectionsDetailItem::WaterUseConnectionsDetailItem(WaterUseConnections
 
   rightVItem1->setGridPos(i,j + 1);
 
-  if( branchCount > 0 )
-  {
-    auto rightVItem2 = new DoubleTwoThreeFourStraightItem(this);
+  i = i + rightVItem1->getHGridLength();
 
-    rightVItem2->setEnableHighlight(false);
+  // Mains supply
+
+  auto mainsSupplyItem = new MainsSupplyItem(this);
+
+  mainsSupplyItem->mainsSupplyButton()->setToolTip("Go back to water mains editor");
+
+  connect(mainsSupplyItem->mainsSupplyButton(), &ButtonItem::mouseClicked,
+    waterUseConnectionsDetailScene, &WaterUseConnectionsDetailScene::goToServiceWaterSceneClicked);
 
-    rightVItem2->setGridPos(i,j + 2);
+  mainsSupplyItem->setGridPos(i,j + 3);
+
+  // Makeup Water
+
+  auto makeupWaterItem = new MakeupWaterItem(this);
+  makeupWaterItem->setGridPos(1,1);
+
+  connect(makeupWaterItem->mainsSupplyButton(), &ButtonItem::mouseClicked,
+    waterUseConnectionsDetailScene, &WaterUseConnectionsDetailScene::goToServiceWaterSceneClicked);
+
+  // Add branches
+
+  layoutBranches();
+}
+
+void WaterUseConnectionsDetailItem::addPipe(GridItem * pipe, int x, int y)
+{
+  pipe->setEnableHighlight(false);
+
+  pipe->setGridPos(x,y);
+
+  m_pipeItems.push_back(pipe);
+}
+
+bool WaterUseConnectionsDetailItem::removeBranch(const Handle & handle)
+{
+  auto it = m_branchItems.find(handle);
+
+  if( it == m_branchItems.end() )
+  {
+    return false;
   }
-  else
+
+  // The object may have been removed from the item's own remove button
+  it->second->hide();
+
+  it->second->deleteLater();
+
+  m_branchItems.erase(it);
+
+  return true;
+}
+
+void WaterUseConnectionsDetailItem::layoutBranches()
+{
+  std::vector<model::WaterUseEquipment> waterEquipmentObjects = m_waterUseConnectionsDetailScene->waterUseConnections().waterUseEquipment();
+
+  int branchCount = waterEquipmentObjects.size();
+
+  std::set<Handle> handles;
+
+  for( const auto & waterUseEquipment : waterEquipmentObjects )
   {
-    auto rightVItem2 = new DoubleTwoFourStraightItem(this);
+    handles.insert(waterUseEquipment.handle());
+  }
 
-    rightVItem2->setEnableHighlight(false);
+  for( auto it = m_branchItems.begin(); it != m_branchItems.end(); )
+  {
+    if( handles.find(it->first) == handles.end() )
+    {
+      delete it->second;
 
-    rightVItem2->setGridPos(i,j + 2);
+      it = m_branchItems.erase(it);
+    }
+    else
+    {
+      ++it;
+    }
   }
 
-  if( branchCount > 1)
+  // Pipes are plain drawings that depend on the branch count, so they are not worth keeping
+
+  for( auto pipe : m_pipeItems )
   {
-    auto rightVItem3 = new ColdWaterJunctionItem(false,this);
+    delete pipe;
+  }
 
-    rightVItem3->setGridPos(i,j + 3);
+  m_pipeItems.clear();
 
-    i = i + rightVItem1->getHGridLength();
+  prepareGeometryChange();
+
+  int i = m_leftColumn;
+  int j = 1;
+
+  // Left Vertical
+
+  if( branchCount > 0 )
+  {
+    addPipe(new OneTwoFourStraightItem(this),i,j + 2);
   }
   else
   {
-    auto rightVItem3 = new ColdWaterJunctionItem(true,this);
-
-    rightVItem3->setGridPos(i,j + 3);
+    addPipe(new TwoFourStraightItem(this),i,j + 2);
+  }
 
-    i = i + rightVItem1->getHGridLength();
+  if( branchCount > 1 )
+  {
+    addPipe(new TwoThreeFourStraightItem(this),i,j + 3);
+  }
+  else
+  {
+    addPipe(new TwoThreeStraightItem(this),i,j + 3);
   }
 
-  // Mains supply
+  // Right Vertical
 
-  auto mainsSupplyItem = new MainsSupplyItem(this);
+  i = m_rightColumn;
 
-  mainsSupplyItem->mainsSupplyButton()->setToolTip("Go back to water mains editor");
+  if( branchCount > 0 )
+  {
+    addPipe(new DoubleTwoThreeFourStraightItem(this),i,j + 2);
+  }
+  else
+  {
+    addPipe(new DoubleTwoFourStraightItem(this),i,j + 2);
+  }
 
-  connect(mainsSupplyItem->mainsSupplyButton(), &ButtonItem::mouseClicked,
-    waterUseConnectionsDetailScene, &WaterUseConnectionsDetailScene::goToServiceWaterSceneClicked);
+  auto rightVItem3 = new ColdWaterJunctionItem(branchCount <= 1,this);
 
-  mainsSupplyItem->setGridPos(i,j + 3);
+  rightVItem3->setGridPos(i,j + 3);
 
-  i = i + mainsSupplyItem->getHGridLength();
+  m_pipeItems.push_back(rightVItem3);
 
-  // Add branches
+  // Branches
 
   j = 3;
 
@@ -242,71 +299,54 @@ WaterUseConnectionsDetailItem::WaterUseConnectionsDetailItem(WaterUseConnections
 
     auto outletItem = new OneThreeStraightItem(this);
 
-    outletItem->setEnableHighlight(false);
-
-    outletItem->setGridPos(i,j);
+    addPipe(outletItem,i,j);
 
     i = i + outletItem->getHGridLength();
 
-    auto waterUseEquipmentItem = new WaterUseEquipmentItem(this);
-
     model::WaterUseEquipment waterUseEquipment = waterEquipmentObjects[b];
 
-    waterUseEquipmentItem->setModelObject(waterUseEquipment);
-
-    waterUseEquipmentItem->setGridPos(i,j);
-
-    i = i + waterUseEquipmentItem->getHGridLength();
+    WaterUseEquipmentItem * waterUseEquipmentItem = nullptr;
 
-    auto inletItem = new DoubleOneThreeStraightItem(this);
+    auto it = m_branchItems.find(waterUseEquipment.handle());
 
-    inletItem->setEnableHighlight(false);
+    if( it != m_branchItems.end() )
+    {
+      waterUseEquipmentItem = it->second;
+    }
+    else
+    {
+      waterUseEquipmentItem = new WaterUseEquipmentItem(this);
 
-    inletItem->setGridPos(i,j);
+      waterUseEquipmentItem->setModelObject(waterUseEquipment);
 
-    if( b != 0 && b < branchCount - 1 )
-    {
-      auto inletJunctionItem = new DoubleTwoThreeFourStraightItem(this);
+      m_branchItems.insert(std::make_pair(waterUseEquipment.handle(),waterUseEquipmentItem));
+    }
 
-      inletJunctionItem->setEnableHighlight(false);
+    waterUseEquipmentItem->setGridPos(i,j);
 
-      inletJunctionItem->setGridPos(8,j);
+    i = i + waterUseEquipmentItem->getHGridLength();
 
-      auto outletJunctionItem = new OneTwoFourStraightItem(this);
+    addPipe(new DoubleOneThreeStraightItem(this),i,j);
 
-      outletJunctionItem->setEnableHighlight(false);
+    if( b != 0 && b < branchCount - 1 )
+    {
+      addPipe(new DoubleTwoThreeFourStraightItem(this),8,j);
 
-      outletJunctionItem->setGridPos(3,j);
+      addPipe(new OneTwoFourStraightItem(this),3,j);
     }
 
     if( b > 1 )
     {
-      auto leftStraight = new TwoFourStraightItem(this);
-
-      leftStraight->setEnableHighlight(false);
+      addPipe(new TwoFourStraightItem(this),3,j - 1);
 
-      leftStraight->setGridPos(3,j - 1);
-
-      auto rightStraight = new DoubleTwoFourStraightItem(this);
-
-      rightStraight->setEnableHighlight(false);
-
-      rightStraight->setGridPos(8,j - 1);
+      addPipe(new DoubleTwoFourStraightItem(this),8,j - 1);
     }
 
     if( b == branchCount - 1 && branchCount > 1 )
     {
-      auto bottomLeftCorner = new OneTwoStraightItem(this);
-
-      bottomLeftCorner->setEnableHighlight(false);
+      addPipe(new OneTwoStraightItem(this),3,j);
 
-      bottomLeftCorner->setGridPos(3,j);
-
-      auto bottomRightCorner = new DoubleTwoThreeStraightItem(this);
-
-      bottomRightCorner->setEnableHighlight(false);
-
-      bottomRightCorner->setGridPos(8,j);
+      addPipe(new DoubleTwoThreeStraightItem(this),8,j);
     }
 
     j = j + 2;
@@ -316,15 +356,12 @@ WaterUseConnectionsDetailItem::WaterUseConnectionsDetailItem(WaterUseConnections
   {
     setVGridLength(j);
   }
+  else
+  {
+    setVGridLength(6);
+  }
 
-  // Makeup Water
-
-  auto makeupWaterItem = new MakeupWaterItem(this);
-  makeupWaterItem->setGridPos(1,1);
-
-  connect(makeupWaterItem->mainsSupplyButton(), &ButtonItem::mouseClicked,
-    waterUseConnectionsDetailScene, &WaterUseConnectionsDetailScene::goToServiceWaterSceneClicked);
-
+  update();
 }
 
 void WaterUseConnectionsDetailItem::paint( QPainter *painter,
@@ -339,14 +376,13 @@ void WaterUseConnectionsDetailItem::paint( QPainter *painter,
 }
 
 ServiceWaterItem::ServiceWaterItem(ServiceWaterScene * serviceWaterScene)
-  : GridItem()
+  : GridItem(),
+    m_serviceWaterScene(serviceWaterScene),
+    m_leftColumn(0),
+    m_rightColumn(0)
 {
   serviceWaterScene->addItem(this);
 
-  std::vector<model::WaterUseConnections> waterConnectionsObjects = serviceWaterScene->model().getConcreteModelObjects<model::WaterUseConnections>();
-
-  int branchCount = waterConnectionsObjects.size();
-
   setHGridLength(12);
 
   //setVGridLength(6);
@@ -362,24 +398,9 @@ ServiceWaterItem::ServiceWaterItem(ServiceWaterScene * serviceWaterScene)
 
   i = i + sewerItem->getHGridLength();
 
-  // Left Vertical
-
-  if( branchCount > 0 )
-  {
-    auto leftVItem1 = new TwoThreeFourStraightItem(this);
-
-    leftVItem1->setEnableHighlight(false);
-
-    leftVItem1->setGridPos(i,j + 1);
-  }
-  else
-  {
-    auto leftVItem1 = new TwoThreeStraightItem(this);
-
-    leftVItem1->setEnableHighlight(false);
+  // Left Vertical depends on the branches
 
-    leftVItem1->setGridPos(i,j + 1);
-  }
+  m_leftColumn = i;
 
   // Left top elbow
 
@@ -427,109 +448,170 @@ ServiceWaterItem::ServiceWaterItem(ServiceWaterScene * serviceWaterScene)
 
   rightTopElbow->setGridPos(i,j);
 
-  // Right Vertical
+  // Right Vertical depends on the branches
 
-  if( branchCount > 0 )
+  m_rightColumn = i;
+
+  i = i + rightTopElbow->getHGridLength();
+
+  // Mains supply
+
+  auto mainsSupplyItem = new MainsSupplyItem(this);
+
+  mainsSupplyItem->setGridPos(i,j + 1);
+
+  // Add branches
+
+  layoutBranches();
+}
+
+void ServiceWaterItem::addPipe(GridItem * pipe, int x, int y)
+{
+  pipe->setEnableHighlight(false);
+
+  pipe->setGridPos(x,y);
+
+  m_pipeItems.push_back(pipe);
+}
+
+bool ServiceWaterItem::removeBranch(const Handle & handle)
+{
+  auto it = m_branchItems.find(handle);
+
+  if( it == m_branchItems.end() )
   {
-    auto rightVItem1 = new OneTwoFourStraightItem(this);
+    return false;
+  }
+
+  // The object may have been removed from the item's own remove button
+  it->second->hide();
+
+  it->second->deleteLater();
+
+  m_branchItems.erase(it);
+
+  return true;
+}
+
+void ServiceWaterItem::layoutBranches()
+{
+  std::vector<model::WaterUseConnections> waterConnectionsObjects = m_serviceWaterScene->model().getConcreteModelObjects<model::WaterUseConnections>();
 
-    rightVItem1->setEnableHighlight(false);
+  int branchCount = waterConnectionsObjects.size();
 
-    rightVItem1->setGridPos(i,j + 1);
+  std::set<Handle> handles;
 
-    i = i + rightVItem1->getHGridLength();
+  for( const auto & waterUseConnections : waterConnectionsObjects )
+  {
+    handles.insert(waterUseConnections.handle());
   }
-  else
+
+  for( auto it = m_branchItems.begin(); it != m_branchItems.end(); )
   {
-    auto rightVItem1 = new OneTwoStraightItem(this);
+    if( handles.find(it->first) == handles.end() )
+    {
+      delete it->second;
 
-    rightVItem1->setEnableHighlight(false);
+      it = m_branchItems.erase(it);
+    }
+    else
+    {
+      ++it;
+    }
+  }
 
-    rightVItem1->setGridPos(i,j + 1);
+  // Pipes are plain drawings that depend on the branch count, so they are not worth keeping
 
-    i = i + rightVItem1->getHGridLength();
+  for( auto pipe : m_pipeItems )
+  {
+    delete pipe;
   }
 
-  // Mains supply
+  m_pipeItems.clear();
 
-  auto mainsSupplyItem = new MainsSupplyItem(this);
+  prepareGeometryChange();
 
-  mainsSupplyItem->setGridPos(i,j + 1);
+  int j = 1;
 
-  i = i + mainsSupplyItem->getHGridLength();
+  // Left Vertical
 
-  // Add branches
+  if( branchCount > 0 )
+  {
+    addPipe(new TwoThreeFourStraightItem(this),m_leftColumn,j + 1);
+  }
+  else
+  {
+    addPipe(new TwoThreeStraightItem(this),m_leftColumn,j + 1);
+  }
+
+  // Right Vertical
+
+  if( branchCount > 0 )
+  {
+    addPipe(new OneTwoFourStraightItem(this),m_rightColumn,j + 1);
+  }
+  else
+  {
+    addPipe(new OneTwoStraightItem(this),m_rightColumn,j + 1);
+  }
+
+  // Branches
 
   j = 3;
 
   for( int b = 0; b < branchCount; b++ )
   {
-    i = 4;
+    int i = 4;
 
     auto outletItem = new OneThreeStraightItem(this);
 
-    outletItem->setEnableHighlight(false);
-
-    outletItem->setGridPos(i,j);
+    addPipe(outletItem,i,j);
 
     i = i + outletItem->getHGridLength();
 
-    auto waterUseConnectionsItem = new WaterUseConnectionsItem(this);
-
-    waterUseConnectionsItem->setModelObject(waterConnectionsObjects[b]);
+    model::WaterUseConnections waterUseConnections = waterConnectionsObjects[b];
 
-    waterUseConnectionsItem->setGridPos(i,j);
-
-    i = i + waterUseConnectionsItem->getHGridLength();
+    WaterUseConnectionsItem * waterUseConnectionsItem = nullptr;
 
-    auto inletItem = new OneThreeStraightItem(this);
+    auto it = m_branchItems.find(waterUseConnections.handle());
 
-    inletItem->setEnableHighlight(false);
+    if( it != m_branchItems.end() )
+    {
+      waterUseConnectionsItem = it->second;
+    }
+    else
+    {
+      waterUseConnectionsItem = new WaterUseConnectionsItem(this);
 
-    inletItem->setGridPos(i,j);
+      waterUseConnectionsItem->setModelObject(waterUseConnections);
 
-    if( b > 0 )
-    {
-      auto leftStraight = new TwoFourStraightItem(this);
+      m_branchItems.insert(std::make_pair(waterUseConnections.handle(),waterUseConnectionsItem));
+    }
 
-      leftStraight->setEnableHighlight(false);
+    waterUseConnectionsItem->setGridPos(i,j);
 
-      leftStraight->setGridPos(3,j - 1);
+    i = i + waterUseConnectionsItem->getHGridLength();
 
-      auto rightStraight = new TwoFourStraightItem(this);
+    addPipe(new OneThreeStraightItem(this),i,j);
 
-      rightStraight->setEnableHighlight(false);
+    if( b > 0 )
+    {
+      addPipe(new TwoFourStraightItem(this),3,j - 1);
 
-      rightStraight->setGridPos(8,j - 1);
+      addPipe(new TwoFourStraightItem(this),8,j - 1);
     }
 
     if( b == branchCount - 1 )
     {
-      auto bottomLeftCorner = new OneTwoStraightItem(this);
-
-      bottomLeftCorner->setEnableHighlight(false);
-
-      bottomLeftCorner->setGridPos(3,j);
+      addPipe(new OneTwoStraightItem(this),3,j);
 
-      auto bottomRightCorner = new TwoThreeStraightItem(this);
-
-      bottomRightCorner->setEnableHighlight(false);
-
-      bottomRightCorner->setGridPos(8,j);
+      addPipe(new TwoThreeStraightItem(this),8,j);
     }
     else
     {
-      auto inletJunctionItem = new TwoThreeFourStraightItem(this);
-
-      inletJunctionItem->setEnableHighlight(false);
-
-      inletJunctionItem->setGridPos(8,j);
+      addPipe(new TwoThreeFourStraightItem(this),8,j);
 
-      auto outletJunctionItem = new OneTwoFourStraightItem(this);
-
-      outletJunctionItem->setEnableHighlight(false);
-
-      outletJunctionItem->setGridPos(3,j);
+      addPipe(new OneTwoFourStraightItem(this),3,j);
     }
 
     j = j + 2;
@@ -541,6 +623,8 @@ ServiceWaterItem::ServiceWaterItem(ServiceWaterScene * serviceWaterScene)
   }
 
   setVGridLength(j);
+
+  update();
 }
 
 void ServiceWaterItem::paint( QPainter *painter,
@@ -36,6 +36,8 @@
 #include <openstudio/model/ModelObject.hpp>
 #include "OSItem.hpp"
 #include "GridItem.hpp"
+#include <map>
+#include <vector>
 
 namespace openstudio {
 
@@ -43,17 +45,42 @@ class ServiceWaterScene;
 
 class WaterUseConnectionsDetailScene;
 
+class WaterUseConnectionsItem;
+
+class WaterUseEquipmentItem;
+
 class ServiceWaterItem : public GridItem
 {
   public:
 
   ServiceWaterItem(ServiceWaterScene * serviceWaterScene);
 
+  // Creates items for new water use connections, drops the ones no longer in the model,
+  // and moves the rest to their rows. Only the connecting pipes are drawn again.
+  void layoutBranches();
+
+  // Returns true if there was an item for the object
+  bool removeBranch(const Handle & handle);
+
   protected:
 
   void paint(QPainter *painter,
              const QStyleOptionGraphicsItem *option,
              QWidget *widget = nullptr) override;
+
+  private:
+
+  void addPipe(GridItem * pipe, int x, int y);
+
+  ServiceWaterScene * m_serviceWaterScene;
+
+  std::map<Handle, WaterUseConnectionsItem *> m_branchItems;
+
+  std::vector<GridItem *> m_pipeItems;
+
+  int m_leftColumn;
+
+  int m_rightColumn;
 };
 
 class WaterUseConnectionsDetailItem : public GridItem
@@ -62,11 +89,31 @@ class WaterUseConnectionsDetailItem : public GridItem
 
   WaterUseConnectionsDetailItem(WaterUseConnectionsDetailScene * waterUseConnectionsDetailScene);
 
+  // Same as ServiceWaterItem::layoutBranches for the water use equipment of the connections
+  void layoutBranches();
+
+  // Returns true if there was an item for the object
+  bool removeBranch(const Handle & handle);
+
   protected:
 
   void paint(QPainter *painter,
              const QStyleOptionGraphicsItem *option,
              QWidget *widget = nullptr) override;
+
+  private:
+
+  void addPipe(GridItem * pipe, int x, int y);
+
+  WaterUseConnectionsDetailScene * m_waterUseConnectionsDetailScene;
+
+  std::map<Handle, WaterUseEquipmentItem *> m_branchItems;
+
+  std::vector<GridItem *> m_pipeItems;
+
+  int m_leftColumn;
+
+  int m_rightColumn;
 };
 
 class WaterUseConnectionsDropZoneItem : public HorizontalBranchItem
@@ -48,7 +48,8 @@ namespace openstudio {
 ServiceWaterScene::ServiceWaterScene(const model::Model & model)
   : GridScene(),
     m_dirty(true),
-    m_model(model)
+    m_model(model),
+    m_serviceWaterItem(nullptr)
 {
   //m_model.getImpl<model::detail::Model_Impl>().get()->addWorkspaceObjectPtr.connect<ServiceWaterScene, &ServiceWaterScene::onAddedWorkspaceObject>(this);
   connect(OSAppBase::instance(), &OSAppBase::workspaceObjectAddedPtr, this, &ServiceWaterScene::onAddedWorkspaceObject, Qt::QueuedConnection);
@@ -60,18 +61,28 @@ ServiceWaterScene::ServiceWaterScene(const model::Model & model)
 
 void ServiceWaterScene::layout()
 {
-  QList<QGraphicsItem *> itemList = items();
-  for( QList<QGraphicsItem *>::iterator it = itemList.begin();
-       it < itemList.end();
-       ++it )
+  if( ! m_dirty ) return;
+
+  // The background item keeps the items of existing branches and only makes the new ones
+  if( m_serviceWaterItem )
+  {
+    m_serviceWaterItem->layoutBranches();
+  }
+  else
   {
-    removeItem(*it);
-    delete *it;
+    m_serviceWaterItem = new ServiceWaterItem(this);
   }
 
-  auto backgroundItem = new ServiceWaterItem(this);
+  m_dirty = false;
+}
 
-  Q_UNUSED(backgroundItem);
+void ServiceWaterScene::layoutLater()
+{
+  if( m_dirty ) return;
+
+  m_dirty = true;
+
+  QTimer::singleShot(0,this,SLOT(layout()));
 }
 
 model::Model ServiceWaterScene::model() const
@@ -84,9 +95,7 @@ void ServiceWaterScene::onAddedWorkspaceObject(std::shared_ptr<openstudio::detai
   model::detail::WaterUseConnections_Impl* hvac_impl = dynamic_cast<model::detail::WaterUseConnections_Impl*>(wPtr.get());
   if(hvac_impl)
   {
-    m_dirty = true;
-
-    QTimer::singleShot(0,this,SLOT(layout()));
+    layoutLater();
   }
 }
 
@@ -95,16 +104,19 @@ void ServiceWaterScene::onRemovedWorkspaceObject(std::shared_ptr<openstudio::det
   model::detail::WaterUseConnections_Impl* hvac_impl = dynamic_cast<model::detail::WaterUseConnections_Impl*>(wPtr.get());
   if(hvac_impl)
   {
-    m_dirty = true;
-
-    QTimer::singleShot(0,this,SLOT(layout()));
+    // The item refers to an object that is gone, so it goes now and the pipes follow with the layout
+    if( m_serviceWaterItem && m_serviceWaterItem->removeBranch(uuid) )
+    {
+      layoutLater();
+    }
   }
 }
 
 WaterUseConnectionsDetailScene::WaterUseConnectionsDetailScene(const model::WaterUseConnections & waterUseConnections)
   : GridScene(),
     m_dirty(true),
-    m_waterUseConnections(waterUseConnections)
+    m_waterUseConnections(waterUseConnections),
+    m_waterUseConnectionsDetailItem(nullptr)
 {
   model::Model model = m_waterUseConnections.model();
 
@@ -124,18 +136,27 @@ model::WaterUseConnections WaterUseConnectionsDetailScene::waterUseConnections()
 
 void WaterUseConnectionsDetailScene::layout()
 {
-  QList<QGraphicsItem *> itemList = items();
-  for( QList<QGraphicsItem *>::iterator it = itemList.begin();
-       it < itemList.end();
-       ++it )
+  if( ! m_dirty ) return;
+
+  if( m_waterUseConnectionsDetailItem )
+  {
+    m_waterUseConnectionsDetailItem->layoutBranches();
+  }
+  else
   {
-    removeItem(*it);
-    delete *it;
+    m_waterUseConnectionsDetailItem = new WaterUseConnectionsDetailItem(this);
   }
 
-  auto backgroundItem = new WaterUseConnectionsDetailItem(this);
+  m_dirty = false;
+}
 
-  Q_UNUSED(backgroundItem);
+void WaterUseConnectionsDetailScene::layoutLater()
+{
+  if( m_dirty ) return;
+
+  m_dirty = true;
+
+  QTimer::singleShot(0,this,SLOT(layout()));
 }
 
 void WaterUseConnectionsDetailScene::onAddedWorkspaceObject(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> wPtr, const openstudio::IddObjectType& type, const openstudio::UUID& uuid)
@@ -143,9 +164,7 @@ void WaterUseConnectionsDetailScene::onAddedWorkspaceObject(std::shared_ptr<open
   model::detail::WaterUseEquipment_Impl * hvac_impl = dynamic_cast<model::detail::WaterUseEquipment_Impl*>(wPtr.get());
   if(hvac_impl)
   {
-    m_dirty = true;
-
-    QTimer::singleShot(0,this,SLOT(layout()));
+    layoutLater();
   }
 }
 
@@ -154,9 +173,10 @@ void WaterUseConnectionsDetailScene::onRemovedWorkspaceObject(std::shared_ptr<op
   model::detail::WaterUseEquipment_Impl * hvac_impl = dynamic_cast<model::detail::WaterUseEquipment_Impl*>(wPtr.get());
   if(hvac_impl)
   {
-    m_dirty = true;
-
-    QTimer::singleShot(0,this,SLOT(layout()));
+    if( m_waterUseConnectionsDetailItem && m_waterUseConnectionsDetailItem->removeBranch(uuid) )
+    {
+      layoutLater();
+    }
   }
 }
 
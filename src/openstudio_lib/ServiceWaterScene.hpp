@@ -44,6 +44,10 @@ class HVACComponent;
 
 }
 
+class ServiceWaterItem;
+
+class WaterUseConnectionsDetailItem;
+
 class ServiceWaterScene : public GridScene
 {
   Q_OBJECT
@@ -60,6 +64,9 @@ class ServiceWaterScene : public GridScene
 
   void layout();
 
+  // Lays the branches out once, when control returns to the event loop
+  void layoutLater();
+
   private slots:
 
   void onAddedWorkspaceObject(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> wPtr, const openstudio::IddObjectType& type, const openstudio::UUID& uuid);
@@ -71,6 +78,8 @@ class ServiceWaterScene : public GridScene
   bool m_dirty;
 
   model::Model m_model;
+
+  ServiceWaterItem * m_serviceWaterItem;
 };
 
 class WaterUseConnectionsDetailScene : public GridScene
@@ -89,6 +98,9 @@ class WaterUseConnectionsDetailScene : public GridScene
 
   void layout();
 
+  // Lays the branches out once, when control returns to the event loop
+  void layoutLater();
+
   signals:
 
   void goToServiceWaterSceneClicked();
@@ -104,6 +116,8 @@ class WaterUseConnectionsDetailScene : public GridScene
   bool m_dirty;
 
   model::WaterUseConnections m_waterUseConnections;
+
+  WaterUseConnectionsDetailItem * m_waterUseConnectionsDetailItem;
 };
 
 } // openstudio
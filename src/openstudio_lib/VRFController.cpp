@@ -37,6 +37,7 @@
 #include "MainWindow.hpp"
 #include "MainRightColumnController.hpp"
 #include <openstudio/model/Model.hpp>
+#include <openstudio/model/Model_Impl.hpp>
 #include <openstudio/model/AirConditionerVariableRefrigerantFlow.hpp>
 #include <openstudio/model/AirConditionerVariableRefrigerantFlow_Impl.hpp>
 #include <openstudio/model/ZoneHVACTerminalUnitVariableRefrigerantFlow.hpp>
@@ -57,6 +58,7 @@
 #include <QGraphicsView>
 #include <QTimer>
 #include <QMessageBox>
+#include <set>
 
 namespace openstudio {
 
@@ -79,6 +81,11 @@ VRFController::VRFController()
   m_vrfSystemGridView->setListController(m_vrfSystemListController);
   m_vrfSystemGridView->setDelegate(QSharedPointer<VRFSystemItemDelegate>(new VRFSystemItemDelegate()));
 
+  std::shared_ptr<OSDocument> doc = OSAppBase::instance()->currentDocument();
+  model::Model t_model = doc->model();
+  t_model.getImpl<model::detail::Model_Impl>().get()->addWorkspaceObject.connect<VRFController, &VRFController::onModelObjectAdd>(this);
+  t_model.getImpl<model::detail::Model_Impl>().get()->removeWorkspaceObject.connect<VRFController, &VRFController::onModelObjectRemove>(this);
+
   zoomOutToSystemGridView();
 }
 
@@ -108,37 +115,55 @@ void VRFController::refreshNow()
 {
   if( ! m_dirty ) return;
 
-  if( m_detailView )
+  if( m_detailView && m_currentSystem )
   {
-    m_detailView->setId(OSItemId());
-    m_detailView->removeAllVRFTerminalViews();
+    m_detailView->setId(OSItemId(toQString(m_currentSystem->handle()), modelToSourceId(m_currentSystem->model()),false));
 
-    if( m_currentSystem )
+    std::set<Handle> handles;
+
+    std::vector<model::ZoneHVACTerminalUnitVariableRefrigerantFlow> terminals = m_currentSystem->terminals();
+    for(auto it = terminals.begin();
+        it != terminals.end();
+        ++it)
     {
-      m_detailView->setId(OSItemId(toQString(m_currentSystem->handle()), modelToSourceId(m_currentSystem->model()),false));
+      handles.insert(it->handle());
 
-      connect(m_detailView.data(), &VRFSystemView::inspectClicked, this, &VRFController::inspectOSItem);
+      VRFTerminalView * vrfTerminalView = nullptr;
 
-      std::vector<model::ZoneHVACTerminalUnitVariableRefrigerantFlow> terminals = m_currentSystem->terminals();
-      for(auto it = terminals.begin();
-          it != terminals.end();
-          ++it)
+      auto viewIt = m_terminalViews.find(it->handle());
+      if( viewIt != m_terminalViews.end() && viewIt->second )
       {
-        auto vrfTerminalView = new VRFTerminalView();
+        vrfTerminalView = viewIt->second;
+      }
+      else
+      {
+        vrfTerminalView = new VRFTerminalView();
         vrfTerminalView->setId(OSItemId(toQString(it->handle()), modelToSourceId(it->model()),false));
         m_detailView->addVRFTerminalView(vrfTerminalView);
         connect(vrfTerminalView, &VRFTerminalView::componentDroppedOnZone, this, &VRFController::onVRFTerminalViewDrop);
         connect(vrfTerminalView, &VRFTerminalView::removeZoneClicked, this, &VRFController::onRemoveZoneClicked);
         connect(vrfTerminalView, &VRFTerminalView::removeTerminalClicked, this, &VRFController::onRemoveTerminalClicked);
         connect(vrfTerminalView, &VRFTerminalView::terminalIconClicked, this, &VRFController::inspectOSItem);
-        if( boost::optional<model::ThermalZone> zone = it->thermalZone() )
+        m_terminalViews[it->handle()] = vrfTerminalView;
+      }
+
+      updateVRFTerminalView(vrfTerminalView,*it);
+    }
+
+    // Terminals moved to another system
+    for( auto it = m_terminalViews.begin(); it != m_terminalViews.end(); )
+    {
+      if( handles.find(it->first) == handles.end() )
+      {
+        if( it->second )
         {
-          vrfTerminalView->zoneDropZone->setHasZone(true);
-          vrfTerminalView->removeZoneButtonItem->setVisible(true);
-          QString zoneName = QString::fromStdString(zone->name().get());
-          vrfTerminalView->zoneDropZone->setText(zoneName);
-          vrfTerminalView->zoneDropZone->setToolTip(zoneName);
+          m_detailView->removeVRFTerminalView(it->second);
         }
+        it = m_terminalViews.erase(it);
+      }
+      else
+      {
+        ++it;
       }
     }
   }
@@ -146,6 +171,57 @@ void VRFController::refreshNow()
   m_dirty = false;
 }
 
+void VRFController::updateVRFTerminalView(VRFTerminalView * view, const model::ZoneHVACTerminalUnitVariableRefrigerantFlow & terminal)
+{
+  if( boost::optional<model::ThermalZone> zone = terminal.thermalZone() )
+  {
+    view->zoneDropZone->setHasZone(true);
+    view->removeZoneButtonItem->setVisible(true);
+    QString zoneName = QString::fromStdString(zone->name().get());
+    view->zoneDropZone->setText(zoneName);
+    view->zoneDropZone->setToolTip(zoneName);
+  }
+  else
+  {
+    view->zoneDropZone->setHasZone(false);
+    view->removeZoneButtonItem->setVisible(false);
+    view->zoneDropZone->setText("Drop Thermal Zone");
+    view->zoneDropZone->setToolTip(QString());
+  }
+}
+
+void VRFController::onModelObjectAdd(const WorkspaceObject& object, const openstudio::IddObjectType& iddObjectType, const openstudio::UUID& handle)
+{
+  // A new terminal is only added to the system after it is made, so look for it once that is done
+  if( m_currentSystem && (iddObjectType == model::ZoneHVACTerminalUnitVariableRefrigerantFlow::iddObjectType()) )
+  {
+    refresh();
+  }
+}
+
+void VRFController::onModelObjectRemove(const WorkspaceObject& object, const openstudio::IddObjectType& iddObjectType, const openstudio::UUID& handle)
+{
+  if( ! m_currentSystem ) return;
+
+  if( iddObjectType == model::ZoneHVACTerminalUnitVariableRefrigerantFlow::iddObjectType() )
+  {
+    auto it = m_terminalViews.find(handle);
+    if( it != m_terminalViews.end() )
+    {
+      if( it->second && m_detailView )
+      {
+        m_detailView->removeVRFTerminalView(it->second);
+      }
+      m_terminalViews.erase(it);
+    }
+  }
+  else if( iddObjectType == model::ThermalZone::iddObjectType() )
+  {
+    // Terminals of the zone show its name
+    refresh();
+  }
+}
+
 void VRFController::onVRFSystemViewDrop(const OSItemId & itemid)
 {
   OS_ASSERT(m_currentSystem);
@@ -287,8 +363,10 @@ void VRFController::zoomInOnSystem(model::AirConditionerVariableRefrigerantFlow
   model::OptionalModelObject mo;
   doc->mainRightColumnController()->inspectModelObject(mo,false);
 
+  m_terminalViews.clear();
   m_detailScene = QSharedPointer<QGraphicsScene>(new QGraphicsScene());
   m_detailView = new VRFSystemView();
+  connect(m_detailView.data(), &VRFSystemView::inspectClicked, this, &VRFController::inspectOSItem);
   connect(m_detailView->terminalDropZone, &OSDropZoneItem::componentDropped, this, &VRFController::onVRFSystemViewDrop);
   connect(m_detailView->zoneDropZone, &OSDropZoneItem::componentDropped, this, &VRFController::onVRFSystemViewZoneDrop);
   m_detailScene->addItem(m_detailView);
@@ -301,13 +379,28 @@ void VRFController::zoomInOnSystem(model::AirConditionerVariableRefrigerantFlow
 
 void VRFController::zoomOutToSystemGridView()
 {
-  m_currentSystem = boost::none;
-
   model::OptionalModelObject mo;
   std::shared_ptr<OSDocument> doc = OSAppBase::instance()->currentDocument();
   doc->mainRightColumnController()->inspectModelObject(mo,false);
 
-  m_vrfSystemListController->reset();
+  // Only the mini view of the system that was open can be out of date, unless it is gone
+  boost::optional<model::AirConditionerVariableRefrigerantFlow> system;
+  if( m_currentSystem )
+  {
+    system = doc->model().getModelObject<model::AirConditionerVariableRefrigerantFlow>(m_currentSystem->handle());
+  }
+
+  if( system )
+  {
+    m_vrfSystemListController->refreshSystem(system->handle());
+  }
+  else
+  {
+    m_vrfSystemListController->reset();
+  }
+
+  m_currentSystem = boost::none;
+  m_terminalViews.clear();
 
   m_vrfView->graphicsView->setScene(m_vrfGridScene.data());
   m_vrfView->graphicsView->setAlignment(Qt::AlignLeft | Qt::AlignTop);
@@ -336,6 +429,21 @@ void VRFSystemListController::reset()
   emit modelReset();
 }
 
+void VRFSystemListController::refreshSystem(const Handle & handle)
+{
+  std::vector<model::AirConditionerVariableRefrigerantFlow> _systems = systems();
+
+  for( size_t i = 0; i < _systems.size(); ++i )
+  {
+    if( _systems[i].handle() == handle )
+    {
+      emit itemChanged(static_cast<int>(i) + 1);
+
+      break;
+    }
+  }
+}
+
 VRFController * VRFSystemListController::vrfController() const
 {
   return m_vrfController;
@@ -32,8 +32,12 @@
 
 #include <QObject>
 #include <QSharedPointer>
+#include <QPointer>
 #include <boost/optional.hpp>
+#include <map>
 #include <openstudio/model/AirConditionerVariableRefrigerantFlow.hpp>
+#include <openstudio/model/ZoneHVACTerminalUnitVariableRefrigerantFlow.hpp>
+#include <openstudio/nano/nano_signal_slot.hpp> // Signal-Slot replacement
 #include "../shared_gui_components/OSListController.hpp"
 
 class QGraphicsScene;
@@ -46,8 +50,9 @@ class VRFSystemListController;
 class GridLayoutItem;
 class VRFView;
 class VRFSystemView;
+class VRFTerminalView;
 
-class VRFController : public QObject
+class VRFController : public QObject, public Nano::Observer
 {
   Q_OBJECT
 
@@ -87,6 +92,12 @@ class VRFController : public QObject
 
   private:
 
+  void onModelObjectAdd(const WorkspaceObject& object, const openstudio::IddObjectType& iddObjectType, const openstudio::UUID& handle);
+
+  void onModelObjectRemove(const WorkspaceObject& object, const openstudio::IddObjectType& iddObjectType, const openstudio::UUID& handle);
+
+  void updateVRFTerminalView(VRFTerminalView * view, const model::ZoneHVACTerminalUnitVariableRefrigerantFlow & terminal);
+
   QPointer<VRFView> m_vrfView;
 
   QPointer<GridLayoutItem> m_vrfSystemGridView;
@@ -101,6 +112,9 @@ class VRFController : public QObject
 
   boost::optional<model::AirConditionerVariableRefrigerantFlow> m_currentSystem;
 
+  // Terminal views of the system in the detail view, so that only the terminals that come and go make or drop a view
+  std::map<Handle, QPointer<VRFTerminalView> > m_terminalViews;
+
   bool m_dirty;
 };
 
@@ -128,6 +142,9 @@ class VRFSystemListController : public OSListController
 
   void removeSystem(model::AirConditionerVariableRefrigerantFlow & system);
 
+  // Refreshes the mini view of the system only
+  void refreshSystem(const Handle & handle);
+
   private:
 
   std::vector<model::AirConditionerVariableRefrigerantFlow> systems() const;
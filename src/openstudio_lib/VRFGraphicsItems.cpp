@@ -39,6 +39,8 @@
 #include <QVBoxLayout>
 #include <QGraphicsView>
 #include <QLabel>
+#include <QTimer>
+#include <algorithm>
 
 namespace openstudio {
 
@@ -84,6 +86,7 @@ VRFSystemView::VRFSystemView()
   : m_mouseDown(false),
     m_width(0),
     m_height(0),
+    m_layoutDirty(false),
     m_vrfPixmap(":images/vrf_outdoor.png")
 {
   vrfIconButton = new ButtonItem(m_vrfPixmap,m_vrfPixmap,m_vrfPixmap);
@@ -105,6 +108,8 @@ VRFSystemView::VRFSystemView()
 
 void VRFSystemView::adjustLayout()
 {
+  m_layoutDirty = false;
+
   prepareGeometryChange();
 
   double x = margin;
@@ -139,6 +144,23 @@ void VRFSystemView::adjustLayout()
   }
 }
 
+void VRFSystemView::adjustLayoutLater()
+{
+  if( m_layoutDirty ) return;
+
+  m_layoutDirty = true;
+
+  QTimer::singleShot(0,this,SLOT(onAdjustLayoutLater()));
+}
+
+void VRFSystemView::onAdjustLayoutLater()
+{
+  if( m_layoutDirty )
+  {
+    adjustLayout();
+  }
+}
+
 void VRFSystemView::setId(const OSItemId & id)
 {
   m_id = id;
@@ -217,7 +239,23 @@ void VRFSystemView::addVRFTerminalView(VRFTerminalView * view)
 {
   m_terminalViews.push_back(view);
   view->setParentItem(this);
-  adjustLayout();
+  adjustLayoutLater();
+}
+
+void VRFSystemView::removeVRFTerminalView(VRFTerminalView * view)
+{
+  auto it = std::find(m_terminalViews.begin(),m_terminalViews.end(),view);
+
+  if( it != m_terminalViews.end() )
+  {
+    m_terminalViews.erase(it);
+
+    // The view may be the sender of the click that removed its terminal
+    view->hide();
+    view->deleteLater();
+
+    adjustLayoutLater();
+  }
 }
 
 void VRFSystemView::removeAllVRFTerminalViews()
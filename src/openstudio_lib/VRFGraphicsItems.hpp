@@ -148,9 +148,13 @@ class VRFSystemView : public QGraphicsObject
   static const int dropZoneHeight;
   static const int terminalViewHeight;
 
+  // Adding and removing terminal views lays the system out once, when control returns to the event loop
   void addVRFTerminalView(VRFTerminalView * view);
+  void removeVRFTerminalView(VRFTerminalView * view);
   void removeAllVRFTerminalViews();
 
+  void adjustLayoutLater();
+
   signals:
 
   void inspectClicked(const OSItemId & id);
@@ -169,11 +173,15 @@ class VRFSystemView : public QGraphicsObject
 
   void onVRFIconClicked();
 
+  void onAdjustLayoutLater();
+
   private:
 
   double m_width;
   double m_height;
 
+  bool m_layoutDirty;
+
   std::vector<QGraphicsObject *> m_terminalViews;
 
   OSItemId m_id;
@@ -0,0 +1,94 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "OpenStudioLibFixture.hpp"
+
+#include "../GridItem.hpp"
+#include "../GridScene.hpp"
+
+#include <openstudio/model/CoilCoolingWater.hpp>
+#include <openstudio/model/Model.hpp>
+#include <openstudio/model/Node.hpp>
+#include <openstudio/model/PlantLoop.hpp>
+
+#include <QElapsedTimer>
+#include <QImage>
+#include <QPainter>
+
+#include <iostream>
+
+using namespace openstudio;
+
+// Lays out and paints the sides of a synthetic plant loop with many demand branches, the timings are printed
+// to compare changes to the HVAC graphics. SystemItem needs an open document, so the sides are added directly.
+TEST_F(OpenStudioLibFixture, GridItem_LargePlantLoopBenchmark)
+{
+  const unsigned numBranches = 200;
+
+  model::Model model;
+  model::PlantLoop plantLoop(model);
+  for (unsigned i = 0; i < numBranches; ++i) {
+    model::CoilCoolingWater coil(model);
+    EXPECT_TRUE(plantLoop.addDemandBranchForComponent(coil));
+  }
+
+  GridScene scene;
+
+  QElapsedTimer timer;
+  timer.start();
+
+  auto supplySide = new SupplySideItem(nullptr, plantLoop.supplyInletNode(), plantLoop.supplyOutletNodes());
+  scene.addItem(supplySide);
+
+  auto demandSide = new DemandSideItem(nullptr, plantLoop.demandInletNodes(), plantLoop.demandOutletNode());
+  demandSide->setGridPos(0, supplySide->getVGridLength() + 1);
+  scene.addItem(demandSide);
+
+  std::cout << "Layout of " << numBranches << " branches: " << timer.elapsed() << " ms" << std::endl;
+
+  EXPECT_GE(demandSide->getVGridLength(), static_cast<int>(numBranches));
+  EXPECT_GT(scene.items().size(), static_cast<int>(numBranches));
+
+  // the default zoom of the HVAC view, then zoomed out to the whole loop where the icons are simplified
+  QImage image(1200, 800, QImage::Format_ARGB32_Premultiplied);
+  const QRectF itemsRect = scene.itemsBoundingRect();
+  for (double zoom : {0.65, 0.05}) {
+    QPainter painter(&image);
+    QRectF source(itemsRect.topLeft(), QSizeF(image.width() / zoom, image.height() / zoom));
+
+    timer.restart();
+    const int numFrames = 10;
+    for (int frame = 0; frame < numFrames; ++frame) {
+      scene.render(&painter, QRectF(image.rect()), source);
+    }
+    std::cout << "Painting at zoom " << zoom << ": " << (timer.elapsed() / static_cast<double>(numFrames)) << " ms per frame" << std::endl;
+  }
+}
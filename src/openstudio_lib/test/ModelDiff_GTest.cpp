@@ -0,0 +1,178 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+
+
+#include <gtest/gtest.h>
+
+#include "OpenStudioLibFixture.hpp"
+
+#include "../ModelDiff.hpp"
+
+#include <openstudio/model/Model.hpp>
+#include <openstudio/model/ScheduleDay.hpp>
+#include <openstudio/model/ScheduleDay_Impl.hpp>
+#include <openstudio/model/Space.hpp>
+#include <openstudio/model/SpaceType.hpp>
+#include <openstudio/model/ThermalZone.hpp>
+
+#include <openstudio/utilities/time/Time.hpp>
+
+#include <algorithm>
+
+using namespace openstudio;
+
+static bool contains(const std::vector<Handle> & handles, const Handle & handle)
+{
+  return std::find(handles.begin(), handles.end(), handle) != handles.end();
+}
+
+// What a measure run gives back, a copy of the model with the same handles
+static model::Model copyOf(const model::Model & model)
+{
+  bool keepHandles = true;
+  return model.clone(keepHandles).cast<model::Model>();
+}
+
+TEST_F(OpenStudioLibFixture, ModelDiff_AddedRemovedChanged)
+{
+  model::Model currentModel;
+  model::Space space(currentModel);
+  space.setName("Space 1");
+  model::SpaceType spaceType(currentModel);
+  spaceType.setName("Space Type 1");
+
+  model::Model newModel = copyOf(currentModel);
+  EXPECT_TRUE(ModelDiff(currentModel, newModel).empty());
+
+  newModel.getModelObject<model::Space>(space.handle())->setName("Renamed Space");
+  newModel.getModelObject<model::SpaceType>(spaceType.handle())->remove();
+  model::ThermalZone thermalZone(newModel);
+
+  ModelDiff diff(currentModel, newModel);
+  EXPECT_FALSE(diff.empty());
+  EXPECT_TRUE(contains(diff.addedObjects(), thermalZone.handle()));
+  EXPECT_EQ(1u, diff.removedObjects().size());
+  EXPECT_TRUE(contains(diff.removedObjects(), spaceType.handle()));
+  EXPECT_EQ(1u, diff.changedObjects().size());
+  EXPECT_TRUE(contains(diff.changedObjects(), space.handle()));
+
+  EXPECT_TRUE(diff.apply());
+
+  EXPECT_EQ("Renamed Space", space.nameString());
+  EXPECT_FALSE(currentModel.getModelObject<model::SpaceType>(spaceType.handle()));
+  EXPECT_EQ(1u, currentModel.getConcreteModelObjects<model::ThermalZone>().size());
+}
+
+TEST_F(OpenStudioLibFixture, ModelDiff_Pointers)
+{
+  model::Model currentModel;
+  model::Space space(currentModel);
+  model::SpaceType spaceType(currentModel);
+  EXPECT_TRUE(space.setSpaceType(spaceType));
+
+  model::Model newModel = copyOf(currentModel);
+
+  // an existing object pointing to an added one
+  model::ThermalZone thermalZone(newModel);
+  thermalZone.setName("Zone 1");
+  EXPECT_TRUE(newModel.getModelObject<model::Space>(space.handle())->setThermalZone(thermalZone));
+
+  // an added object pointing to an existing one
+  model::Space addedSpace(newModel);
+  addedSpace.setName("Added Space");
+  EXPECT_TRUE(addedSpace.setSpaceType(newModel.getModelObject<model::SpaceType>(spaceType.handle()).get()));
+
+  ModelDiff diff(currentModel, newModel);
+  EXPECT_TRUE(contains(diff.changedObjects(), space.handle()));
+
+  EXPECT_TRUE(diff.apply());
+
+  std::vector<model::ThermalZone> thermalZones = currentModel.getConcreteModelObjects<model::ThermalZone>();
+  ASSERT_EQ(1u, thermalZones.size());
+  ASSERT_TRUE(space.thermalZone());
+  EXPECT_EQ(thermalZones[0].handle(), space.thermalZone()->handle());
+  EXPECT_EQ("Zone 1", space.thermalZone()->nameString());
+
+  boost::optional<model::Space> currentAddedSpace = currentModel.getModelObjectByName<model::Space>("Added Space");
+  ASSERT_TRUE(currentAddedSpace);
+  ASSERT_TRUE(currentAddedSpace->spaceType());
+  EXPECT_EQ(spaceType.handle(), currentAddedSpace->spaceType()->handle());
+}
+
+// A pointer moved to another object of the same name is a change
+TEST_F(OpenStudioLibFixture, ModelDiff_SameNamedTarget)
+{
+  model::Model currentModel;
+  model::Space space(currentModel);
+  model::SpaceType spaceType(currentModel);
+  spaceType.setName("Office");
+  EXPECT_TRUE(space.setSpaceType(spaceType));
+
+  model::Model newModel = copyOf(currentModel);
+  newModel.getModelObject<model::SpaceType>(spaceType.handle())->remove();
+  model::SpaceType replacement(newModel);
+  replacement.setName("Office");
+  EXPECT_TRUE(newModel.getModelObject<model::Space>(space.handle())->setSpaceType(replacement));
+
+  ModelDiff diff(currentModel, newModel);
+  EXPECT_TRUE(contains(diff.changedObjects(), space.handle()));
+
+  EXPECT_TRUE(diff.apply());
+
+  ASSERT_TRUE(space.spaceType());
+  EXPECT_NE(spaceType.handle(), space.spaceType()->handle());
+  EXPECT_EQ("Office", space.spaceType()->nameString());
+}
+
+// Extensible groups the measure removed are removed from the current object too
+TEST_F(OpenStudioLibFixture, ModelDiff_FewerExtensibleGroups)
+{
+  model::Model currentModel;
+  model::ScheduleDay scheduleDay(currentModel);
+  scheduleDay.clearValues();
+  EXPECT_TRUE(scheduleDay.addValue(Time(0, 8, 0), 0.0));
+  EXPECT_TRUE(scheduleDay.addValue(Time(0, 18, 0), 1.0));
+  EXPECT_TRUE(scheduleDay.addValue(Time(0, 24, 0), 0.0));
+
+  model::Model newModel = copyOf(currentModel);
+  model::ScheduleDay newScheduleDay = newModel.getModelObject<model::ScheduleDay>(scheduleDay.handle()).get();
+  newScheduleDay.clearValues();
+  EXPECT_TRUE(newScheduleDay.addValue(Time(0, 24, 0), 0.5));
+
+  ModelDiff diff(currentModel, newModel);
+  EXPECT_TRUE(contains(diff.changedObjects(), scheduleDay.handle()));
+
+  EXPECT_TRUE(diff.apply());
+
+  EXPECT_EQ(newScheduleDay.numExtensibleGroups(), scheduleDay.numExtensibleGroups());
+  EXPECT_EQ(newScheduleDay.numFields(), scheduleDay.numFields());
+  ASSERT_EQ(1u, scheduleDay.values().size());
+  EXPECT_DOUBLE_EQ(0.5, scheduleDay.values()[0]);
+}
@@ -0,0 +1,79 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "OpenStudioLibFixture.hpp"
+
+#include "../RunProgressChannel.hpp"
+
+#include <QStringList>
+
+using namespace openstudio;
+
+TEST_F(OpenStudioLibFixture, RunProgressChannel_PartialLines)
+{
+  RunProgressChannel channel;
+
+  QStringList messages;
+  QObject::connect(&channel, &RunProgressChannel::messageReceived, [&messages](const QString & text, int) { messages << text; });
+
+  std::vector<int> states;
+  QObject::connect(&channel, &RunProgressChannel::stateChanged, [&states](int state) { states.push_back(state); });
+
+  // lines split across reads
+  channel.appendData("Starting state initi");
+  EXPECT_EQ(RunProgressChannel::stopped, channel.state());
+  EXPECT_TRUE(messages.isEmpty());
+
+  channel.appendData("alization\nReturned from state initialization\r\nStarting state translator\nApplying Measure");
+  EXPECT_EQ(RunProgressChannel::translator, channel.state());
+  ASSERT_EQ(2, messages.size());
+  EXPECT_EQ("Initializing workflow.", messages[0]);
+  EXPECT_EQ("Translating the OpenStudio Model to EnergyPlus.", messages[1]);
+  ASSERT_EQ(2u, states.size());
+  EXPECT_EQ(RunProgressChannel::initialization, states[0]);
+  EXPECT_EQ(RunProgressChannel::translator, states[1]);
+
+  EXPECT_GE(channel.stateDurationMSecs(RunProgressChannel::initialization), 0);
+  EXPECT_EQ(-1, channel.stateDurationMSecs(RunProgressChannel::translator));
+
+  // partial line is delivered on flush
+  channel.flush();
+  ASSERT_EQ(3, messages.size());
+  EXPECT_EQ("Applying Measure", messages[2]);
+
+  channel.appendData("COMPLETE\n");
+  ASSERT_EQ(4, messages.size());
+  EXPECT_EQ("Completed.", messages[3]);
+
+  channel.reset();
+  EXPECT_EQ(RunProgressChannel::stopped, channel.state());
+  EXPECT_EQ(-1, channel.stateDurationMSecs(RunProgressChannel::initialization));
+}
@@ -0,0 +1,194 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+
+#include <gtest/gtest.h>
+
+#include "OpenStudioLibFixture.hpp"
+
+#include "../ScheduleEvaluation.hpp"
+
+#include <openstudio/model/Model.hpp>
+#include <openstudio/model/ScheduleDay.hpp>
+#include <openstudio/model/ScheduleRule.hpp>
+#include <openstudio/model/ScheduleRuleset.hpp>
+#include <openstudio/model/YearDescription.hpp>
+
+#include <openstudio/utilities/time/Date.hpp>
+#include <openstudio/utilities/time/Time.hpp>
+
+#include <numeric>
+
+using namespace openstudio;
+
+static void setApplyDays(model::ScheduleRule & rule, bool weekdays, bool weekends)
+{
+  rule.setApplySunday(weekends);
+  rule.setApplyMonday(weekdays);
+  rule.setApplyTuesday(weekdays);
+  rule.setApplyWednesday(weekdays);
+  rule.setApplyThursday(weekdays);
+  rule.setApplyFriday(weekdays);
+  rule.setApplySaturday(weekends);
+}
+
+// The rule of each day is worked out from a copy of the rules, it has to agree with the model
+TEST_F(OpenStudioLibFixture, ScheduleEvaluation_ActiveRuleIndices)
+{
+  model::Model model;
+  model::YearDescription yearDescription = model.getUniqueModelObject<model::YearDescription>();
+
+  model::ScheduleRuleset scheduleRuleset(model);
+
+  // summer weekdays
+  model::ScheduleRule summer(scheduleRuleset);
+  summer.setStartDate(yearDescription.makeDate(6, 1));
+  summer.setEndDate(yearDescription.makeDate(8, 31));
+  setApplyDays(summer, true, false);
+
+  // holidays on any day of the week
+  model::ScheduleRule holidays(scheduleRuleset);
+  EXPECT_TRUE(holidays.addSpecificDate(yearDescription.makeDate(7, 4)));
+  EXPECT_TRUE(holidays.addSpecificDate(yearDescription.makeDate(12, 25)));
+  setApplyDays(holidays, true, true);
+
+  // winter across the new year
+  model::ScheduleRule winter(scheduleRuleset);
+  winter.setStartDate(yearDescription.makeDate(11, 15));
+  winter.setEndDate(yearDescription.makeDate(2, 15));
+  setApplyDays(winter, true, true);
+
+  // never applies
+  model::ScheduleRule never(scheduleRuleset);
+  never.setStartDate(yearDescription.makeDate(1, 1));
+  never.setEndDate(yearDescription.makeDate(12, 31));
+  setApplyDays(never, false, false);
+
+  for (int year : {2009, 2012, 2017}) {
+    yearDescription.setCalendarYear(year);
+
+    int assumedYear = yearDescription.assumedYear();
+    std::vector<int> expected = scheduleRuleset.getActiveRuleIndices(Date(1, 1, assumedYear), Date(12, 31, assumedYear));
+
+    EXPECT_EQ(expected, activeRuleIndices(scheduleRulesetData(scheduleRuleset))) << "Year " << year;
+  }
+}
+
+TEST_F(OpenStudioLibFixture, ScheduleEvaluation_HourlyValues)
+{
+  model::Model model;
+  model::YearDescription yearDescription = model.getUniqueModelObject<model::YearDescription>();
+  yearDescription.setCalendarYear(2009);
+
+  model::ScheduleRuleset scheduleRuleset(model);
+
+  // off until 8:00, then on, 16 full load hours
+  model::ScheduleDay defaultDay = scheduleRuleset.defaultDaySchedule();
+  defaultDay.clearValues();
+  defaultDay.addValue(Time(0, 8, 0), 0.0);
+  defaultDay.addValue(Time(0, 24, 0), 1.0);
+
+  // half on in December, the step at 12:30 splits an hour
+  model::ScheduleRule december(scheduleRuleset);
+  december.setStartDate(yearDescription.makeDate(12, 1));
+  december.setEndDate(yearDescription.makeDate(12, 31));
+  setApplyDays(december, true, true);
+  december.daySchedule().clearValues();
+  december.daySchedule().addValue(Time(0, 12, 30), 0.0);
+  december.daySchedule().addValue(Time(0, 24, 0), 1.0);
+
+  ScheduleRulesetData data = scheduleRulesetData(scheduleRuleset);
+  std::vector<double> values = hourlyValues(data, activeRuleIndices(data));
+
+  ASSERT_EQ(8760u, values.size());
+  EXPECT_EQ(0.0, values[7]);
+  EXPECT_EQ(1.0, values[8]);
+
+  // 12:00 to 13:00 on December 1st
+  EXPECT_DOUBLE_EQ(0.5, values[(334 * 24) + 12]);
+
+  double fullLoadHours = std::accumulate(values.begin(), values.end(), 0.0);
+  EXPECT_DOUBLE_EQ(334 * 16.0 + 31 * 11.5, fullLoadHours);
+  EXPECT_DOUBLE_EQ(fullLoadHours, evaluateScheduleRuleset(data).statistics.fullLoadHours);
+
+  // ramps from 0 at 8:00 to 1 at 10:00
+  defaultDay.setInterpolatetoTimestep(true);
+  defaultDay.clearValues();
+  defaultDay.addValue(Time(0, 8, 0), 0.0);
+  defaultDay.addValue(Time(0, 10, 0), 1.0);
+  defaultDay.addValue(Time(0, 24, 0), 1.0);
+
+  data = scheduleRulesetData(scheduleRuleset);
+  values = hourlyValues(data, activeRuleIndices(data));
+
+  EXPECT_DOUBLE_EQ(0.25, values[8]);
+  EXPECT_DOUBLE_EQ(0.75, values[9]);
+}
+
+TEST_F(OpenStudioLibFixture, ScheduleEvaluation_AnnualValues)
+{
+  model::Model model;
+  model::YearDescription yearDescription = model.getUniqueModelObject<model::YearDescription>();
+  yearDescription.setCalendarYear(2009);
+
+  model::ScheduleRuleset scheduleRuleset(model);
+
+  // off until 8:10, then 0.5 until 18:00, then off
+  model::ScheduleDay defaultDay = scheduleRuleset.defaultDaySchedule();
+  defaultDay.clearValues();
+  defaultDay.addValue(Time(0, 8, 10), 0.0);
+  defaultDay.addValue(Time(0, 18, 0), 0.5);
+  defaultDay.addValue(Time(0, 24, 0), 0.0);
+
+  ScheduleRulesetData data = scheduleRulesetData(scheduleRuleset);
+  std::vector<int> indices = activeRuleIndices(data);
+
+  for (int minutesPerStep : {1, 10, 15, 60}) {
+    std::vector<double> values = annualValues(data, indices, minutesPerStep);
+
+    ASSERT_EQ(365u * 24 * 60 / minutesPerStep, values.size()) << minutesPerStep << " minutes";
+
+    // the integral does not depend on the step
+    ScheduleStatistics statistics = scheduleStatistics(values, minutesPerStep);
+    EXPECT_NEAR(365 * 0.5 * (9.0 + 5.0 / 6.0), statistics.fullLoadHours, 1.0e-6) << minutesPerStep << " minutes";
+    EXPECT_NEAR(365 * (9.0 + 5.0 / 6.0), statistics.equivalentFullLoadHours, 1.0e-6) << minutesPerStep << " minutes";
+    EXPECT_DOUBLE_EQ(0.0, statistics.minimum);
+    EXPECT_DOUBLE_EQ(0.5, statistics.maximum);
+  }
+
+  std::vector<double> values = annualValues(data, indices, 10);
+  EXPECT_DOUBLE_EQ(0.0, values[48]);
+  EXPECT_DOUBLE_EQ(0.5, values[49]);
+  EXPECT_DOUBLE_EQ(0.0, values[108]);
+
+  // the hour from 8:00 to 9:00 counts as on
+  ScheduleStatistics statistics = evaluateScheduleRuleset(data).statistics;
+  EXPECT_DOUBLE_EQ(365 * 10.0, statistics.nonZeroHours);
+  EXPECT_NEAR(0.5 * (9.0 + 5.0 / 6.0) / 24.0, statistics.mean, 1.0e-9);
+}
@@ -35,6 +35,8 @@
 #include <QApplication>
 #include <QGraphicsScene>
 
+#include <algorithm>
+
 namespace openstudio {
 
 AbstractButtonItem::AbstractButtonItem(QGraphicsItem * parent)
@@ -190,7 +192,8 @@ ZoomOutButtonItem::ZoomOutButtonItem(QGraphicsItem * parent)
 
 GridLayoutItem::GridLayoutItem()
   : m_cellSize(100,100),
-    m_margin(10)
+    m_margin(10),
+    m_virtualized(false)
 {
 }
 
@@ -225,6 +228,20 @@ void GridLayoutItem::setMargin(int margin)
   m_margin = margin;
 }
 
+void GridLayoutItem::setVirtualized(bool virtualized)
+{
+  m_virtualized = virtualized;
+
+  realizeVisibleItemViews();
+}
+
+void GridLayoutItem::setVisibleRect(const QRectF & rect)
+{
+  m_visibleRect = mapRectFromScene(rect);
+
+  realizeVisibleItemViews();
+}
+
 QRectF GridLayoutItem::boundingRect() const
 {
   int x = columns() * (cellSize().width() + spacing()) - spacing() + margin() * 2.0;
@@ -273,12 +290,14 @@ void GridLayoutItem::refreshAllItemViews()
     delete *it;
   }
 
-  if( m_listController )
+  m_gridPosItemViewPairs.clear();
+  m_itemViewGridPosPairs.clear();
+
+  realizeVisibleItemViews();
+
+  if( QGraphicsScene * _scene = scene() )
   {
-    for( int i = 0; i < m_listController->count(); i++ )
-    {
-      insertItemView(i);
-    }
+    _scene->setSceneRect(boundingRect());
   }
 }
 
@@ -332,21 +351,20 @@ void GridLayoutItem::insertItemView(int index)
     // Move existing views forward one grid position
     for( int i = (m_listController->count() - 2); i >= index; i-- )
     {
-      std::pair<int,int> oldPos = gridPos(i);
-
-      QGraphicsObject * item = viewFromGridPos(oldPos);
-
-      std::pair<int,int> newPos = gridPos(i + 1);
-
-      setItemViewGridPos(item,newPos);
+      moveItemView(i, i + 1);
     }
 
+    m_gridPosItemViewPairs.erase(gridPos(index));
+
     // Create new item and position it at index grid position
-    if( QGraphicsObject * item = createNewItemView(index) )
+    if( isCellVisible(index) )
     {
-      std::pair<int,int> pos = gridPos(index);
+      if( QGraphicsObject * item = createNewItemView(index) )
+      {
+        std::pair<int,int> pos = gridPos(index);
 
-      setItemViewGridPos(item,pos);
+        setItemViewGridPos(item,pos);
+      }
     }
 
     if( QGraphicsScene * _scene = scene() )
@@ -360,29 +378,26 @@ void GridLayoutItem::removeItemView(int index)
 {
   if( m_listController )
   {
-    // Remove Item
+    prepareGeometryChange();
+
+    // Remove Item, a virtualized grid may not have created it
     if(QGraphicsObject * itemViewToRemove = viewFromGridPos(gridPos(index)))
     {
-      prepareGeometryChange();
-
       removePair(itemViewToRemove);
 
       itemViewToRemove->deleteLater();
+    }
 
-      // Move Everything after index back one grid position
-      for( int i = index + 1; i < m_listController->count() + 1; i++ )
-      {
-        std::pair<int,int> oldPos = gridPos(i);
-
-        QGraphicsObject * item = viewFromGridPos(oldPos);
-
-        OS_ASSERT(item);
+    // Move Everything after index back one grid position
+    for( int i = index + 1; i < m_listController->count() + 1; i++ )
+    {
+      moveItemView(i, i - 1);
+    }
 
-        std::pair<int,int> newPos = gridPos(i - 1);
+    m_gridPosItemViewPairs.erase(gridPos(m_listController->count()));
 
-        setItemViewGridPos(item,newPos);
-      }
-    }
+    // Cells moving into sight
+    realizeVisibleItemViews();
 
     if( QGraphicsScene * _scene = scene() )
     {
@@ -424,6 +439,20 @@ void GridLayoutItem::removePair(QObject * object)
 
 void GridLayoutItem::refreshItemView(int i)
 {
+  if( QGraphicsObject * oldItemView = viewFromGridPos(gridPos(i)) )
+  {
+    removePair(oldItemView);
+
+    oldItemView->deleteLater();
+  }
+
+  if( isCellVisible(i) )
+  {
+    if( QGraphicsObject * item = createNewItemView(i) )
+    {
+      setItemViewGridPos(item,gridPos(i));
+    }
+  }
 }
 
 int GridLayoutItem::spacing() const
@@ -488,4 +517,81 @@ QGraphicsObject * GridLayoutItem::viewFromGridPos(std::pair<int,int> location)
   return result;
 }
 
+void GridLayoutItem::moveItemView(int from, int to)
+{
+  if( QGraphicsObject * item = viewFromGridPos(gridPos(from)) )
+  {
+    setItemViewGridPos(item,gridPos(to));
+  }
+  else
+  {
+    m_gridPosItemViewPairs.erase(gridPos(to));
+  }
+}
+
+QRectF GridLayoutItem::cellRect(int i)
+{
+  std::pair<int,int> pos = gridPos(i);
+
+  int x = pos.second * (cellSize().width() + spacing()) + margin();
+  int y = pos.first * (cellSize().height() + spacing()) + margin();
+
+  return QRectF(QPointF(x,y),cellSize());
+}
+
+bool GridLayoutItem::isCellVisible(int i)
+{
+  if( ! m_virtualized )
+  {
+    return true;
+  }
+
+  // One row ahead in both directions so that scrolling doesn't show empty cells
+  qreal ahead = cellSize().height() + spacing();
+
+  return m_visibleRect.adjusted(0,-ahead,0,ahead).intersects(cellRect(i));
+}
+
+void GridLayoutItem::realizeVisibleItemViews()
+{
+  if( ! m_listController || ! m_delegate )
+  {
+    return;
+  }
+
+  int count = m_listController->count();
+
+  int begin = 0;
+  int end = count;
+
+  if( m_virtualized )
+  {
+    if( m_visibleRect.isNull() )
+    {
+      return;
+    }
+
+    // Only the rows that intersect the visible rect, plus one ahead
+    qreal rowHeight = cellSize().height() + spacing();
+    int firstRow = std::max(0, static_cast<int>((m_visibleRect.top() - margin()) / rowHeight) - 1);
+    int lastRow = static_cast<int>((m_visibleRect.bottom() - margin()) / rowHeight) + 1;
+
+    begin = std::min(count, firstRow * columns());
+    end = std::min(count, (lastRow + 1) * columns());
+  }
+
+  for( int i = begin; i < end; i++ )
+  {
+    std::pair<int,int> pos = gridPos(i);
+
+    if( ! viewFromGridPos(pos) && isCellVisible(i) )
+    {
+      if( QGraphicsObject * item = createNewItemView(i) )
+      {
+        setItemViewGridPos(item,pos);
+      }
+    }
+  }
+}
+
 } // openstudio
@@ -165,6 +165,13 @@ class GridLayoutItem : public QGraphicsObject
 
   void setMargin(int margin);
 
+  // When virtualized, item views are created only for the cells that intersect the visible rect,
+  // they are created as the cells come into sight
+  void setVirtualized(bool virtualized);
+
+  // The part of the scene shown by the view, in scene coordinates
+  void setVisibleRect(const QRectF & rect);
+
   public slots:
 
   void refreshAllItemViews();
@@ -201,6 +208,15 @@ class GridLayoutItem : public QGraphicsObject
 
   QGraphicsObject * viewFromGridPos(std::pair<int,int> gridPos);
 
+  void moveItemView(int from, int to);
+
+  QRectF cellRect(int i);
+
+  bool isCellVisible(int i);
+
+  // Creates the views of the visible cells that don't have one yet
+  void realizeVisibleItemViews();
+
   QSharedPointer<OSGraphicsItemDelegate> m_delegate;
 
   QSharedPointer<OSListController> m_listController;
@@ -215,6 +231,10 @@ class GridLayoutItem : public QGraphicsObject
   QSizeF m_cellSize;
 
   int m_margin;
+
+  bool m_virtualized;
+
+  QRectF m_visibleRect;
 };
 
 } // openstudio
@@ -1024,6 +1024,50 @@ class OptionalValueEditConceptImpl : public OptionalValueEditConcept<ValueType>
 };
 
 
+///////////////////////////////////////////////////////////////////////////////////
+
+// A value worked out for the object that is shown but cannot be edited
+template<typename ValueType>
+class ValueDisplayConcept : public BaseConcept
+{
+  public:
+
+    ValueDisplayConcept(const Heading &t_heading)
+      : BaseConcept(t_heading)
+  {
+  }
+
+   virtual ~ValueDisplayConcept() {}
+
+  virtual boost::optional<ValueType> get(const ConceptProxy & obj) = 0;
+};
+
+template<typename ValueType, typename DataSourceType>
+class ValueDisplayConceptImpl : public ValueDisplayConcept<ValueType>
+{
+  public:
+
+  ValueDisplayConceptImpl(const Heading &t_heading,
+    std::function<boost::optional<ValueType> (DataSourceType *)>  t_getter)
+    : ValueDisplayConcept<ValueType>(t_heading),
+      m_getter(t_getter)
+  {
+  }
+
+  virtual ~ValueDisplayConceptImpl() {}
+
+  virtual boost::optional<ValueType> get(const ConceptProxy & t_obj)
+  {
+    DataSourceType obj = t_obj.cast<DataSourceType>();
+    return m_getter(&obj);
+  }
+
+  private:
+
+  std::function<boost::optional<ValueType> (DataSourceType *)>  m_getter;
+};
+
+
 ///////////////////////////////////////////////////////////////////////////////////
 
 
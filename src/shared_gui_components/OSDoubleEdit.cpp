@@ -330,6 +330,12 @@ void OSDoubleEdit2::onEditingFinished() {
   }
 }
 
+void OSDoubleEdit2::refresh() {
+  if (m_modelObject){
+    refreshTextAndLabel();
+  }
+}
+
 void OSDoubleEdit2::onModelObjectChange() {
   if (m_modelExtensibleGroup){
     if (m_modelExtensibleGroup->empty()){
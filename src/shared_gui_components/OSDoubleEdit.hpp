@@ -124,6 +124,9 @@ class OSDoubleEdit2: public QLineEdit, public Nano::Observer {
 
   void unbind();
 
+  // Reads the value again, for getters that depend on more than the bound object
+  void refresh();
+
  signals:
 
   void inFocus(bool inFocus, bool hasData);
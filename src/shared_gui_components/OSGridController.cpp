@@ -859,6 +859,21 @@ namespace openstudio {
 
       widget = optionalDoubleEdit;
 
+    }
+    else if (QSharedPointer<ValueDisplayConcept<double> > doubleDisplayConcept = t_baseConcept.dynamicCast<ValueDisplayConcept<double> >()) {
+
+      auto doubleDisplay = new OSDoubleEdit2(this->gridView());
+
+      doubleDisplay->bind(t_mo,
+        OptionalDoubleGetter(std::bind(&ValueDisplayConcept<double>::get, doubleDisplayConcept.data(), t_mo)));
+
+      doubleDisplay->setReadOnly(true);
+
+      isConnected = connect(this, &OSGridController::displayValuesChanged, doubleDisplay, &OSDoubleEdit2::refresh);
+      OS_ASSERT(isConnected);
+
+      widget = doubleDisplay;
+
     }
     else if (QSharedPointer<ValueEditVoidReturnConcept<double> > doubleEditVoidReturnConcept = t_baseConcept.dynamicCast<ValueEditVoidReturnConcept<double> >()) {
 
@@ -1285,6 +1300,9 @@ namespace openstudio {
       auto temp = getter();
       if (temp) setter(temp.get());
     }
+    else if (t_baseConcept.dynamicCast<ValueDisplayConcept<double> >()) {
+      // Nothing to set
+    }
     else {
       // Unknown type
       OS_ASSERT(false);
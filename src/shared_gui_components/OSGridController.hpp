@@ -438,6 +438,15 @@ public:
     m_baseConcepts.push_back(makeDataSourceAdapter(QSharedPointer<OptionalValueEditConcept<ValueType> >(new OptionalValueEditConceptImpl<ValueType, DataSourceType>(heading,getter,setter)), t_source));
   }
 
+  // Read only, the cells are refreshed when the object changes or displayValuesChanged is emitted
+  template<typename ValueType, typename DataSourceType>
+  void addValueDisplayColumn(const Heading &heading,
+                             std::function<boost::optional<ValueType> (DataSourceType *)>  getter,
+                             const boost::optional<DataSource> &t_source = boost::none)
+  {
+    m_baseConcepts.push_back(makeDataSourceAdapter(QSharedPointer<ValueDisplayConcept<ValueType> >(new ValueDisplayConceptImpl<ValueType, DataSourceType>(heading,getter)), t_source));
+  }
+
   template<typename ValueType, typename DataSourceType>
   void addValueEditColumn(const Heading &heading,
                           std::function<ValueType (DataSourceType *)>  getter,
@@ -709,6 +718,9 @@ signals:
 
   void toggleUnitsClicked(bool displayIP);
 
+  // Values of display columns that depend on more than the object of their row may have changed
+  void displayValuesChanged();
+
 public slots:
 
   virtual void onItemDropped(const OSItemId& itemId) = 0;